@@ -35,6 +35,7 @@
 /*================== Includes =============================================*/
 #include "appltask_cfg.h"
 #include "diag.h"
+#include "resistance.h"
 /*================== Macros and Definitions ===============================*/
 
 /*================== Constant and Variable Definitions ====================*/
@@ -54,6 +55,8 @@ BMS_Task_Definition_s appl_tskdef_100ms = { 50, 100, osPriorityLow,         512/
 void APPL_Cyclic_10ms(void) {
     DIAG_SysMonNotify(DIAG_SYSMON_APPL_CYCLIC_10ms, 0);        // task is running, state = ok
 
+    RES_Ctrl();
+
     /* User specific implementations:   */
     /*   ...                            */
     /*   ...                            */
@@ -0,0 +1,124 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    resistance_cfg.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup APPLICATION_CONF
+ * @prefix  RES
+ *
+ * @brief   Configuration header for the online estimation of the internal cell resistance
+ *
+ */
+
+#ifndef RESISTANCE_CFG_H_
+#define RESISTANCE_CFG_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*fox
+ * enables the estimation of the DC internal resistance of each cell from the voltage/current
+ * pairs of DATA_BLOCK_ID_CELLVOLTAGE_CURRENT. These pairs are only written when
+ * LTC_VOLTAGE_CURRENT_SYNC is enabled in the LTC configuration, which is therefore required.
+ * @var         enable internal resistance estimation
+ * @type        select(2)
+ * @default     0
+ * @level       user
+ * @group       RES
+ */
+//#define RES_ESTIMATION            TRUE
+#define RES_ESTIMATION            FALSE
+
+/*fox
+ * number of cells evaluated per call of RES_Ctrl() (10ms application task). Bounds the
+ * runtime of one call, a complete set of pairs is evaluated in
+ * BS_NR_OF_BAT_CELLS/RES_CELLS_PER_TICK calls. Newer pairs arriving in the meantime are skipped.
+ * @var         cells evaluated per 10ms tick
+ * @type        int
+ * @validator   [1,BS_NR_OF_BAT_CELLS]
+ * @default     24
+ * @level       user
+ * @group       RES
+ */
+#define RES_CELLS_PER_TICK          24
+
+/*fox
+ * minimum current difference between two consecutive pairs of a cell to evaluate dV/dI.
+ * Smaller steps are dominated by the voltage resolution of the measurement.
+ * @var         minimum current step
+ * @type        int
+ * @unit        mA
+ * @validator   [1000,500000]
+ * @default     10000
+ * @level       user
+ * @group       RES
+ */
+#define RES_MIN_CURRENT_STEP        10000
+
+/*fox
+ * maximum time between two consecutive pairs of a cell to evaluate dV/dI. Over longer intervals
+ * the voltage change is dominated by polarization and by the change of the open circuit voltage.
+ * @var         maximum interval between two pairs
+ * @type        int
+ * @unit        ms
+ * @validator   [10,2000]
+ * @default     200
+ * @level       user
+ * @group       RES
+ */
+#define RES_MAX_SAMPLE_INTERVAL     200
+
+/*fox
+ * weight of a new dV/dI value in the exponential filter of the resistance
+ * (1.0: no filtering)
+ * @var         filter weight
+ * @type        float
+ * @validator   0.0<x<=1.0
+ * @default     0.05
+ * @level       user
+ * @group       RES
+ */
+#define RES_FILTER_WEIGHT           0.05
+
+/*fox
+ * dV/dI values outside of ]0,RES_MAX_RESISTANCE[ are discarded as implausible
+ * @var         maximum plausible resistance
+ * @type        float
+ * @unit        mOhm
+ * @validator   x>0.0
+ * @default     100.0
+ * @level       user
+ * @group       RES
+ */
+#define RES_MAX_RESISTANCE          100.0
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#endif /* RESISTANCE_CFG_H_ */
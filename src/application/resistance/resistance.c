@@ -0,0 +1,210 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    resistance.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  RES
+ *
+ * @brief   Online estimation of the DC internal resistance of each cell
+ *
+ * The resistance is estimated from the voltage/current pairs of DATA_BLOCK_ID_CELLVOLTAGE_CURRENT,
+ * where each cell voltage is paired with the current at the instant of its conversion. Between two
+ * consecutive pairs of a cell with a sufficient current step, -dV/dI is an estimate of the resistance
+ * (positive current: discharge). The estimates are smoothed with an exponential filter.
+ */
+
+
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "resistance.h"
+
+#include "database.h"
+#include "ltc_cfg.h"
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if (RES_ESTIMATION == TRUE) && (LTC_VOLTAGE_CURRENT_SYNC != TRUE)
+#error "RES_ESTIMATION needs the voltage/current pairs of LTC_VOLTAGE_CURRENT_SYNC"
+#endif
+#if (RES_ESTIMATION == TRUE) && (DATA_SEQLOCK_ACCESS != TRUE)
+#error "RES_ESTIMATION needs DATA_SEQLOCK_ACCESS"
+#endif
+
+/**
+ * last voltage/current pair of a cell
+ */
+typedef struct {
+    uint16_t voltage;           /*!< unit: mV                                   */
+    float current;              /*!< unit: mA                                   */
+    uint32_t conversion_us;     /*!< time of the conversion, unit: us           */
+    uint8_t valid;              /*!< TRUE if the pair can be used for dV/dI     */
+} RES_PAIR_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+#if RES_ESTIMATION == TRUE
+/* module-local, the stack of the 10ms application task is too small for these tables */
+static DATA_BLOCK_CELLVOLTAGE_CURRENT_s res_pairs;        /* set of pairs evaluated over several calls */
+static DATA_BLOCK_CELLRESISTANCE_s res_resistance;
+static RES_PAIR_s res_lastPair[BS_NR_OF_BAT_CELLS];
+
+static uint32_t res_pairs_timestamp = 0;
+static uint16_t res_nextCell = BS_NR_OF_BAT_CELLS;     /* BS_NR_OF_BAT_CELLS: set of pairs completed */
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+#if RES_ESTIMATION == TRUE
+static void RES_EvaluateCell(uint16_t cell);
+static void RES_Publish(void);
+#endif
+
+/*================== Function Implementations =============================*/
+
+void RES_Ctrl(void) {
+#if RES_ESTIMATION == TRUE
+    uint16_t cell = 0;
+    uint16_t lastCell = 0;
+
+    if (res_nextCell >= BS_NR_OF_BAT_CELLS) {
+        /* res_pairs is kept unchanged while its cells are evaluated */
+        if ((DATA_GetTable(&res_pairs, DATA_BLOCK_ID_CELLVOLTAGE_CURRENT) != E_OK) ||
+                (res_pairs.timestamp == res_pairs_timestamp)) {
+            return;     /* no new set of pairs */
+        }
+        res_pairs_timestamp = res_pairs.timestamp;
+        res_nextCell = 0;
+    }
+
+    lastCell = res_nextCell + RES_CELLS_PER_TICK;
+    if (lastCell > BS_NR_OF_BAT_CELLS) {
+        lastCell = BS_NR_OF_BAT_CELLS;
+    }
+
+    for (cell = res_nextCell; cell < lastCell; cell++) {
+        RES_EvaluateCell(cell);
+    }
+    res_nextCell = lastCell;
+
+    if (res_nextCell >= BS_NR_OF_BAT_CELLS) {
+        RES_Publish();
+    }
+#endif
+}
+
+
+#if RES_ESTIMATION == TRUE
+/**
+ * @brief   evaluates the new pair of a cell against its last pair and updates the resistance
+ *
+ * @param   cell    index of the cell in the battery system
+ *
+ * @return  void
+ */
+static void RES_EvaluateCell(uint16_t cell) {
+    uint16_t module = cell / BS_NR_OF_BAT_CELLS_PER_MODULE;
+    uint16_t cellInModule = cell % BS_NR_OF_BAT_CELLS_PER_MODULE;
+    RES_PAIR_s *lastPair = &res_lastPair[cell];
+    uint16_t voltage = res_pairs.voltage[cell];
+    float current = res_pairs.current[cell];
+    uint32_t conversion_us = res_pairs.conversion_us[cell];
+    uint8_t valid = FALSE;
+    float deltaI = 0.0;
+    float resistance = 0.0;
+
+    if (((res_pairs.valid[module] >> cellInModule) & 0x01) == 0) {
+        valid = TRUE;
+    }
+
+    if (valid == TRUE && lastPair->valid == TRUE &&
+            (conversion_us - lastPair->conversion_us) <= RES_MAX_SAMPLE_INTERVAL*1000) {
+        deltaI = current - lastPair->current;
+        if (deltaI >= RES_MIN_CURRENT_STEP || deltaI <= -RES_MIN_CURRENT_STEP) {
+            /* mV/mA = Ohm, scaled to mOhm */
+            resistance = -((float)((int32_t)voltage - (int32_t)lastPair->voltage) / deltaI) * 1000.0;
+            if (resistance > 0.0 && resistance < RES_MAX_RESISTANCE) {
+                if (res_resistance.nr_of_updates[cell] == 0) {
+                    res_resistance.resistance[cell] = resistance;
+                } else {
+                    res_resistance.resistance[cell] += RES_FILTER_WEIGHT * (resistance - res_resistance.resistance[cell]);
+                }
+                if (res_resistance.nr_of_updates[cell] < 0xFFFF) {
+                    res_resistance.nr_of_updates[cell]++;
+                }
+            }
+        }
+    }
+
+    lastPair->voltage = voltage;
+    lastPair->current = current;
+    lastPair->conversion_us = conversion_us;
+    lastPair->valid = valid;
+}
+
+
+/**
+ * @brief   computes mean and maximum of the estimated resistances and stores them in the database
+ *
+ * @return  void
+ */
+static void RES_Publish(void) {
+    uint16_t cell = 0;
+    uint16_t nr_of_estimated = 0;
+    uint16_t cell_max = 0;
+    float sum = 0.0;
+    float max = 0.0;
+
+    for (cell = 0; cell < BS_NR_OF_BAT_CELLS; cell++) {
+        if (res_resistance.nr_of_updates[cell] > 0) {
+            sum += res_resistance.resistance[cell];
+            nr_of_estimated++;
+            if (res_resistance.resistance[cell] > max) {
+                max = res_resistance.resistance[cell];
+                cell_max = cell;
+            }
+        }
+    }
+
+    if (nr_of_estimated > 0) {
+        res_resistance.resistance_mean = sum / (float)nr_of_estimated;
+    }
+    res_resistance.resistance_max = max;
+    res_resistance.resistance_module_number_max = cell_max / BS_NR_OF_BAT_CELLS_PER_MODULE;
+    res_resistance.resistance_cell_number_max = cell_max % BS_NR_OF_BAT_CELLS_PER_MODULE;
+
+    res_resistance.previous_timestamp = res_resistance.timestamp;
+    res_resistance.timestamp = MCU_GetTimeStamp();
+    DATA_StoreDataBlock(&res_resistance, DATA_BLOCK_ID_CELLRESISTANCE);
+}
+#endif
@@ -0,0 +1,61 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    resistance.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup APPLICATION
+ * @prefix  RES
+ *
+ * @brief   Header for the online estimation of the internal cell resistance
+ *
+ */
+
+#ifndef RESISTANCE_H_
+#define RESISTANCE_H_
+
+/*================== Includes =============================================*/
+#include "resistance_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   incremental estimation of the DC internal resistance of each cell
+ *
+ * Takes a new set of voltage/current pairs from DATA_BLOCK_ID_CELLVOLTAGE_CURRENT and evaluates
+ * RES_CELLS_PER_TICK cells of it per call. For each cell, -dV/dI between its last two pairs is
+ * filtered into the resistance when the current step is large enough. When all cells of the set
+ * have been evaluated, the results are stored in DATA_BLOCK_ID_CELLRESISTANCE.
+ * Must be called cyclically, e.g. in the 10ms application task.
+ *
+ * @return  void
+ */
+extern void RES_Ctrl(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* RESISTANCE_H_ */
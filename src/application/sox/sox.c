@@ -60,6 +60,7 @@ static DATA_BLOCK_CANERRORSIG_s canerrtab;
 
 static SOX_SOF_s values_sof;
 static uint32_t soc_previous_current_timestamp = 0;
+static uint32_t soc_current_version = 0;
 
 /** @{
  * module-local static Variables that are calculated at startup and used later to avoid divisions at runtime
@@ -99,6 +100,7 @@ static float SOF_MinimumOfThreeValues (float value1,float value2, float value3);
 void SOC_Init(void) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
 
+    soc_current_version = DATA_GetVersion(DATA_BLOCK_ID_CURRENT);
     DATA_GetTable(&sox_current_tab, DATA_BLOCK_ID_CURRENT);
     soc_previous_current_timestamp = sox_current_tab.timestamp;
     //soc = EEPR_Get_nvsoc();
@@ -153,6 +155,7 @@ void SOC_Init_Lookup_Table(void) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
 
     DATA_GetTable(&cellminmax, DATA_BLOCK_ID_MINMAX);
+    soc_current_version = DATA_GetVersion(DATA_BLOCK_ID_CURRENT);
     DATA_GetTable(&sox_current_tab, DATA_BLOCK_ID_CURRENT);
 
     soc_mean = SOC_GetFromVoltage((float)(cellminmax.voltage_mean));
@@ -218,7 +221,13 @@ void SOC_Ctrl(void) {
     SOX_SOC_s soc = {50.0, 50.0, 50.0};
     float deltaSOC = 0.0;
 
+#if DATA_SEQLOCK_ACCESS == TRUE
+    if (DATA_GetTableIfNew(&sox_current_tab, DATA_BLOCK_ID_CURRENT, &soc_current_version) != E_OK) {
+        return;     // current measurement has not been stored since the last call, nothing to integrate
+    }
+#else
     DATA_GetTable(&sox_current_tab, DATA_BLOCK_ID_CURRENT);
+#endif
 
     timestamp = sox_current_tab.timestamp;
     previous_timestamp = sox_current_tab.previous_timestamp;
@@ -395,6 +395,11 @@ static uint8_t BMSCTRL_CheckMeasDiag(void) {
     static DATA_BLOCK_MINMAX_s minmax;
     static DATA_BLOCK_CURRENT_s curr_tab;
     static DATA_BLOCK_CANERRORSIG_s error_tab;
+#if BMSCTRL_TEST_MUX_MEAS_AGE == TRUE
+    static DATA_BLOCK_MUXAGE_s muxage;
+    uint32_t now = 0;
+    uint8_t i = 0;
+#endif
 
     DATA_GetTable(&minmax, DATA_BLOCK_ID_MINMAX);
     DATA_GetTable(&curr_tab, DATA_BLOCK_ID_CURRENT);
@@ -417,6 +422,17 @@ static uint8_t BMSCTRL_CheckMeasDiag(void) {
     }
 #endif
 
+#if BMSCTRL_TEST_MUX_MEAS_AGE == TRUE
+    DATA_GetTable(&muxage, DATA_BLOCK_ID_MUXAGE);
+    now = MCU_GetTimeStamp();
+    for (i = 0; i < DATA_NR_OF_MUX_CHANNELS; i++) {
+        // channels that were never measured are not part of the multiplexer sequence
+        if ((muxage.last_measurement[i] != 0) && ((now - muxage.last_measurement[i]) > BMSCTRL_MUX_MEAS_AGE_MAX)) {
+            retVal = FALSE;
+        }
+    }
+#endif
+
     if (minmax.temperature_max > BC_TEMPMAX){
         error_tab.error_hightemp = 1;
         retVal = FALSE;
@@ -93,6 +93,30 @@
 //#define BMSCTRL_TEST_CELL_SOF_LIMITS  TRUE
 #define BMSCTRL_TEST_CELL_SOF_LIMITS FALSE
 
+/*fox
+ * checking if the multiplexer measurements (temperatures) are up to date, i.e. if every measured
+ * multiplexer channel was measured within BMSCTRL_MUX_MEAS_AGE_MAX.
+ * This test condition is only evaluated if BMSCTRL_TEST_CELL_LIMITS is TRUE.
+ * @var Multiplexer measurement age test enable
+ * @type select(2)
+ * @default 0
+ * @level debug
+ * @group BMSCTRL
+ */
+//#define BMSCTRL_TEST_MUX_MEAS_AGE  TRUE
+#define BMSCTRL_TEST_MUX_MEAS_AGE FALSE
+
+/*fox
+ * maximum age of a multiplexer measurement in ms
+ * @var Maximum multiplexer measurement age
+ * @type int
+ * @default 10000
+ * @valid 0<x
+ * @level user
+ * @group BMSCTRL
+ */
+#define BMSCTRL_MUX_MEAS_AGE_MAX   10000
+
 /*fox
  * this is the ID that should be requested via CAN signal to go to STANDBY state (ready, but no contactors closed)
  * @var ID to request for STANDBY state
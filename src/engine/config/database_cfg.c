@@ -44,7 +44,7 @@
 /**
  * data block: cell voltage
  */
-DATA_BLOCK_CELLVOLTAGE_s data_block_cellvoltage[DOUBLE_BUFFERING];
+DATA_BLOCK_CELLVOLTAGE_s data_block_cellvoltage[TRIPLE_BUFFERING];
 
 /**
  * data block: cell temperature
@@ -96,6 +96,41 @@ DATA_BLOCK_MINMAX_s data_block_minmax[DOUBLE_BUFFERING];
  */
 DATA_BLOCK_ISOMETER_s data_block_isometer[SINGLE_BUFFERING];
 
+/**
+ * data block: age of the multiplexer measurements
+ */
+DATA_BLOCK_MUXAGE_s data_block_muxage[DOUBLE_BUFFERING];
+
+/**
+ * data block: state of the cell voltage burst capture
+ */
+DATA_BLOCK_BURSTCAPTURE_s data_block_burstcapture[SINGLE_BUFFERING];
+
+/**
+ * data block: cell voltages with the current at their conversion
+ */
+DATA_BLOCK_CELLVOLTAGE_CURRENT_s data_block_cellvoltage_current[DOUBLE_BUFFERING];
+
+/**
+ * data block: estimated internal cell resistances
+ */
+DATA_BLOCK_CELLRESISTANCE_s data_block_cellresistance[DOUBLE_BUFFERING];
+
+/**
+ * data block: communication health of the LTC daisy-chain
+ */
+DATA_BLOCK_LTC_COMMHEALTH_s data_block_ltc_commhealth[DOUBLE_BUFFERING];
+
+/**
+ * data block: timing of the LTC state machine
+ */
+DATA_BLOCK_LTC_TIMING_s data_block_ltc_timing[DOUBLE_BUFFERING];
+
+/**
+ * data block: request of a cell voltage burst capture
+ */
+DATA_BLOCK_BURSTREQUEST_s data_block_burstrequest[SINGLE_BUFFERING];
+
 
 
 /**
@@ -109,7 +144,7 @@ DATA_BASE_HEADER_s  data_base_header[] =
     {
             (void*)(&data_block_cellvoltage[0]),
             sizeof(DATA_BLOCK_CELLVOLTAGE_s),
-            DOUBLE_BUFFERING,
+            TRIPLE_BUFFERING,
     },
     {
             (void*)(&data_block_celltemperature[0]),
@@ -161,6 +196,41 @@ DATA_BASE_HEADER_s  data_base_header[] =
             sizeof(DATA_BLOCK_ISOMETER_s),
             SINGLE_BUFFERING,
     },
+    {
+            (void*)(&data_block_muxage[0]),
+            sizeof(DATA_BLOCK_MUXAGE_s),
+            DOUBLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_burstcapture[0]),
+            sizeof(DATA_BLOCK_BURSTCAPTURE_s),
+            SINGLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_cellvoltage_current[0]),
+            sizeof(DATA_BLOCK_CELLVOLTAGE_CURRENT_s),
+            DOUBLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_cellresistance[0]),
+            sizeof(DATA_BLOCK_CELLRESISTANCE_s),
+            DOUBLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_ltc_commhealth[0]),
+            sizeof(DATA_BLOCK_LTC_COMMHEALTH_s),
+            DOUBLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_ltc_timing[0]),
+            sizeof(DATA_BLOCK_LTC_TIMING_s),
+            DOUBLE_BUFFERING,
+    },
+    {
+            (void*)(&data_block_burstrequest[0]),
+            sizeof(DATA_BLOCK_BURSTREQUEST_s),
+            SINGLE_BUFFERING,
+    },
 };
 
 /**
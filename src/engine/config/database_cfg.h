@@ -46,7 +46,7 @@
  *
  * this value is extendible but limitation is done due to RAM consumption and performance
  */
-#define DATA_MAX_BLOCK_NR                15        /* max 15 Blocks actually supported*/
+#define DATA_MAX_BLOCK_NR                18        /* max 18 Blocks actually supported*/
 
 /**
  * @brief data block identification number
@@ -67,6 +67,9 @@ typedef enum {
     DATA_BLOCK_13       = 12,
     DATA_BLOCK_14       = 13,
     DATA_BLOCK_15       = 14,
+    DATA_BLOCK_16       = 15,
+    DATA_BLOCK_17       = 16,
+    DATA_BLOCK_18       = 17,
     DATA_BLOCK_MAX      = DATA_MAX_BLOCK_NR,
 } DATA_BLOCK_ID_TYPE_e;
 
@@ -85,13 +88,14 @@ typedef enum
 /**
  * @brief data block consistency types
  *
- * recommendation: use single buffer for small data (e.g.,one variable) and less concurrent read and write accesses
+ * recommendation: use single buffer for small data (e.g.,one variable) and less concurrent read and write accesses,
+ * use triple buffer for data which is stored at a high rate
  */
 typedef enum {
     // Init-Sequence
     SINGLE_BUFFERING    = 1,    /*!< single buffering   */
     DOUBLE_BUFFERING    = 2,    /*!< double buffering   */
- // TRIPLEBUFFERING     = 3,    /* actually not supported*/
+    TRIPLE_BUFFERING    = 3,    /*!< triple buffering, the data block must be stored by one task only   */
 }DATA_BLOCK_CONSISTENCY_TYPE_e;
 
 /**
@@ -113,6 +117,56 @@ typedef struct {
 
 
 /*================== Macros and Definitions [USER CONFIGURATION] =============*/
+
+/*fox
+ * enables the synchronous database access. DATA_GetTable() and DATA_StoreDataBlock() copy the
+ * data block in the context of the caller instead of sending a request to the database task.
+ * Reads are protected by a sequence counter per data block and do not block the writers.
+ * If set to FALSE, the copies are made by the database task after the call (see DATA_GetTable()).
+ * @var synchronous database access
+ * @type select(2)
+ * @default 1
+ * @level advanced
+ * @group DATABASE
+ */
+#define DATA_SEQLOCK_ACCESS TRUE
+//#define DATA_SEQLOCK_ACCESS FALSE
+
+/*fox
+ * enables the profiling of the database accesses (counters per data block, time spent by the
+ * callers, queue occupancy and latency from request to copy)
+ * @var database profiling
+ * @type select(2)
+ * @default 0
+ * @level debug
+ * @group DATABASE
+ */
+//#define DATA_PROFILING TRUE
+#define DATA_PROFILING FALSE
+
+/**
+ * number of tasks which are profiled separately, accesses of further tasks are not assigned
+ */
+#define DATA_PROFILING_NR_OF_CALLERS                8
+
+/**
+ * number of bins of the latency histogram, the last bin collects all longer latencies
+ */
+#define DATA_PROFILING_NR_OF_BINS                   16
+
+/**
+ * width of a bin of the latency histogram, unit: us
+ */
+#define DATA_PROFILING_BIN_US                       100
+
+/**
+ * number of lock-free read attempts of DATA_GetTable() before the data block is copied in a
+ * critical section. A read attempt fails when the data block is stored during the copy.
+ * Triple buffered data blocks are never copied in a critical section, their read attempt only
+ * fails when the data block is stored twice during the copy.
+ */
+#define DATA_SEQLOCK_MAX_RETRIES                    3
+
 // FIXME comments doxygen, is comment necessary?
 /*Macros and Definitions for User Configuration*/
 #define     DATA_BLOCK_ID_CELLVOLTAGE                   DATA_BLOCK_1
@@ -126,6 +180,38 @@ typedef struct {
 #define     DATA_BLOCK_ID_CANERRORSIG                   DATA_BLOCK_9
 #define     DATA_BLOCK_ID_MINMAX                        DATA_BLOCK_10
 #define     DATA_BLOCK_ID_ISOGUARD                      DATA_BLOCK_11
+#define     DATA_BLOCK_ID_MUXAGE                        DATA_BLOCK_12
+#define     DATA_BLOCK_ID_BURSTCAPTURE                  DATA_BLOCK_13
+#define     DATA_BLOCK_ID_CELLVOLTAGE_CURRENT           DATA_BLOCK_14
+#define     DATA_BLOCK_ID_CELLRESISTANCE                DATA_BLOCK_15
+#define     DATA_BLOCK_ID_LTC_COMMHEALTH                DATA_BLOCK_16
+#define     DATA_BLOCK_ID_LTC_TIMING                    DATA_BLOCK_17
+#define     DATA_BLOCK_ID_BURSTREQUEST                  DATA_BLOCK_18
+
+/**
+ * number of multiplexer channels of a LTC (4 multiplexers with 8 channels), channel index is muxID*8+muxCh
+ */
+#define     DATA_NR_OF_MUX_CHANNELS                     32
+
+/**
+ * number of LTC monitoring ICs (one per module), must be equal to LTC_N_LTC
+ */
+#define     DATA_NR_OF_LTC                              BS_NR_OF_MODULES
+
+/**
+ * number of samples of a cell voltage burst capture, must be equal to LTC_BURST_SAMPLES
+ */
+#define     DATA_NR_OF_BURST_SAMPLES                    32
+
+/**
+ * number of evaluated states of the LTC state machine (LTC_STATEMACH_UNDEFINED+1), the error states are counted as LTC_STATEMACH_UNDEFINED
+ */
+#define     DATA_LTC_TIMING_NR_OF_STATES                21
+
+/**
+ * number of bins of the LTC timing histograms
+ */
+#define     DATA_LTC_TIMING_NR_OF_BINS                  16
 
 
 /**
@@ -221,6 +307,7 @@ typedef struct {
     float voltage[BS_NR_OF_VOLTAGES_FROM_CURRENT_SENSOR];  /*!<                                    */
     uint32_t previous_timestamp;                        /*!< timestamp of last database entry   */
     uint32_t timestamp;                                 /*!< timestamp of database entry        */
+    uint32_t timestamp_us;                              /*!< reception of the current, unit: us (MCU_GetTime_us())  */
     uint8_t state_current;
     uint8_t state_voltage;
 } DATA_BLOCK_CURRENT_s;
@@ -316,6 +403,141 @@ typedef struct {
     uint32_t previous_timestamp;    /*!< timestamp of last database entry                                   */
 } DATA_BLOCK_ISOMETER_s;
 
+/**
+ * data block struct of the age of the multiplexer measurements
+ *
+ * The age of a channel is MCU_GetTimeStamp() - last_measurement[channel].
+ */
+typedef struct {
+    uint32_t last_measurement[DATA_NR_OF_MUX_CHANNELS]; /*!< timestamp of the last measurement of the channel, 0 if not measured        */
+    uint32_t hot_channels;          /*!< bitmask of the channels measured more often (changing quickly or close to a limit)         */
+    uint32_t timestamp;             /*!< timestamp of database entry                                                                */
+    uint32_t previous_timestamp;    /*!< timestamp of last database entry                                                           */
+    uint8_t state;                  /*!< for future use                                                                             */
+} DATA_BLOCK_MUXAGE_s;
+
+/**
+ * sample of a cell voltage burst capture
+ */
+typedef struct {
+    uint16_t voltage[BS_NR_OF_BAT_CELLS];   /*!< unit: mV                                                           */
+    uint32_t timestamp;                     /*!< timestamp of the start of the conversion, unit: ms                 */
+    float current;                          /*!< current of DATA_BLOCK_ID_CURRENT read with the sample, unit: mA    */
+} DATA_BURST_SAMPLE_s;
+
+/**
+ * data block struct of the cell voltage burst capture, only written by the LTC driver
+ *
+ * The samples are stored when a capture starts and when it ends. While capturing is FALSE, the
+ * nr_of_samples samples from sample[first_sample] on (wrapping around) are the last capture.
+ */
+typedef struct {
+    DATA_BURST_SAMPLE_s sample[DATA_NR_OF_BURST_SAMPLES];  /*!< ring buffer of the samples             */
+    uint16_t first_sample;          /*!< index of the oldest sample in the ring buffer                      */
+    uint8_t request_handled;        /*!< value of DATA_BLOCK_BURSTREQUEST_s.request when the last capture was started */
+    uint8_t capturing;              /*!< TRUE while a capture is running                                    */
+    uint16_t nr_of_samples;         /*!< number of samples of the last capture in the ring buffer           */
+    uint32_t nr_of_captures;        /*!< number of finished captures                                        */
+    uint32_t trigger_timestamp;     /*!< timestamp of the start of the last capture                         */
+    float trigger_current;          /*!< current when the last capture was started, unit: mA                */
+    uint32_t timestamp;             /*!< timestamp of database entry                                        */
+    uint32_t previous_timestamp;    /*!< timestamp of last database entry                                   */
+    uint8_t state;                  /*!< for future use                                                     */
+} DATA_BLOCK_BURSTCAPTURE_s;
+
+/**
+ * data block struct of the burst capture request, only written by the requester
+ *
+ * A capture is armed by incrementing request, the state of the capture is in DATA_BLOCK_BURSTCAPTURE_s.
+ */
+typedef struct {
+    uint8_t request;                /*!< a capture is started when request differs from request_handled     */
+    uint32_t timestamp;             /*!< timestamp of database entry                                        */
+    uint32_t previous_timestamp;    /*!< timestamp of last database entry                                   */
+    uint8_t state;                  /*!< for future use                                                     */
+} DATA_BLOCK_BURSTREQUEST_s;
+
+/**
+ * data block struct of the cell voltages with the current at their conversion
+ *
+ * The cells of an LTC register group are converted at different times, the current is
+ * interpolated between the two current samples around the conversion of each cell.
+ */
+typedef struct {
+    uint16_t voltage[BS_NR_OF_BAT_CELLS];           /*!< unit: mV                                                       */
+    float current[BS_NR_OF_BAT_CELLS];              /*!< current at the conversion of the cell, unit: mA                */
+    uint32_t conversion_us[BS_NR_OF_BAT_CELLS];     /*!< time of the conversion of the cell, unit: us (MCU_GetTime_us()) */
+    uint32_t valid[BS_NR_OF_MODULES];               /*!< bitmask if voltage and current are valid. 0->ok, 1->error      */
+    uint32_t previous_timestamp;                    /*!< timestamp of last database entry                               */
+    uint32_t timestamp;                             /*!< timestamp of database entry                                    */
+    uint8_t state;                                  /*!< for future use                                                 */
+} DATA_BLOCK_CELLVOLTAGE_CURRENT_s;
+
+/**
+ * data block struct of the estimated internal cell resistances
+ */
+typedef struct {
+    float resistance[BS_NR_OF_BAT_CELLS];           /*!< DC internal resistance, unit: mOhm, 0 if not estimated yet     */
+    uint16_t nr_of_updates[BS_NR_OF_BAT_CELLS];     /*!< number of evaluated current steps, saturates at 0xFFFF         */
+    float resistance_mean;                          /*!< mean resistance of the estimated cells, unit: mOhm             */
+    float resistance_max;                           /*!< highest resistance, unit: mOhm                                 */
+    uint16_t resistance_module_number_max;          /*!< module of the cell with the highest resistance                 */
+    uint16_t resistance_cell_number_max;            /*!< cell of the module with the highest resistance                 */
+    uint32_t previous_timestamp;                    /*!< timestamp of last database entry                               */
+    uint32_t timestamp;                             /*!< timestamp of database entry                                    */
+    uint8_t state;                                  /*!< for future use                                                 */
+} DATA_BLOCK_CELLRESISTANCE_s;
+
+/**
+ * data block struct of the communication health of the LTC daisy-chain
+ *
+ * The counters are not reset by a re-initialization of the LTC driver. The multiplexers of a
+ * module are connected to its first LTC, the channel index is muxID*8+muxCh.
+ */
+typedef struct {
+    uint16_t pec_errors_per_1000[DATA_NR_OF_LTC];   /*!< frames with PEC error per 1000 frames over the last LTC_HEALTH_WINDOW frames of the LTC  */
+    uint16_t retries[DATA_NR_OF_LTC];               /*!< frames read again because of a PEC error of the LTC, saturates at 0xFFFF               */
+    uint32_t since_good_frame[DATA_NR_OF_LTC];      /*!< time since the last frame of the LTC with correct PEC, unit: ms, 0xFFFFFFFF if none    */
+    uint32_t pec_failing[(DATA_NR_OF_LTC+31)/32];   /*!< bitmask of the LTCs whose last frame had a PEC error. 0->ok, 1->error                  */
+    uint16_t mux_nacks[BS_NR_OF_MODULES][DATA_NR_OF_MUX_CHANNELS];  /*!< not acknowledged I2C transfers to the channel, saturates at 0xFFFF */
+    uint16_t mux_nacks_off[BS_NR_OF_MODULES];       /*!< not acknowledged I2C transfers switching a multiplexer off, saturates at 0xFFFF       */
+    uint32_t mux_nack_channels[BS_NR_OF_MODULES];   /*!< bitmask of the channels whose last I2C transfer was not acknowledged                  */
+    uint32_t previous_timestamp;                    /*!< timestamp of last database entry                                                       */
+    uint32_t timestamp;                             /*!< timestamp of database entry                                                            */
+    uint8_t state;                                  /*!< for future use                                                                         */
+} DATA_BLOCK_LTC_COMMHEALTH_s;
+
+/**
+ * statistics of a duration measured by the LTC timing instrumentation
+ */
+typedef struct {
+    uint32_t min_us;                                /*!< shortest duration, unit: us                                    */
+    uint32_t avg_us;                                /*!< mean duration, unit: us                                        */
+    uint32_t max_us;                                /*!< longest duration, unit: us                                     */
+    uint32_t count;                                 /*!< number of measured durations                                   */
+    uint16_t histogram[DATA_LTC_TIMING_NR_OF_BINS]; /*!< number of durations per bin, saturates at 0xFFFF               */
+} DATA_LTC_TIMING_STATISTICS_s;
+
+/**
+ * data block struct of the timing of the LTC state machine
+ *
+ * The time of a cycle is split into the wait for ltc_state.timer (conversions and the 1ms
+ * resolution of the timer), the wait for SPI transfers and the time spent in LTC_Trigger().
+ */
+typedef struct {
+    DATA_LTC_TIMING_STATISTICS_s cycle;                                 /*!< measurement cycles, bins of LTC_TIMING_CYCLE_BIN_US            */
+    DATA_LTC_TIMING_STATISTICS_s state_duration[DATA_LTC_TIMING_NR_OF_STATES];  /*!< time from entry to exit of each state, bins of LTC_TIMING_STATE_BIN_US */
+    uint32_t last_cycle_timer_us;                   /*!< wait for ltc_state.timer in the last cycle, unit: us           */
+    uint32_t last_cycle_transfer_us;                /*!< wait for SPI transfers in the last cycle, unit: us             */
+    uint32_t last_cycle_handler_us;                 /*!< time spent in LTC_Trigger() in the last cycle, unit: us        */
+    uint32_t max_cycle_timer_us;                    /*!< wait for ltc_state.timer in the longest cycle, unit: us        */
+    uint32_t max_cycle_transfer_us;                 /*!< wait for SPI transfers in the longest cycle, unit: us          */
+    uint32_t max_cycle_handler_us;                  /*!< time spent in LTC_Trigger() in the longest cycle, unit: us     */
+    uint32_t previous_timestamp;                    /*!< timestamp of last database entry                               */
+    uint32_t timestamp;                             /*!< timestamp of database entry                                    */
+    uint8_t state;                                  /*!< for future use                                                 */
+} DATA_BLOCK_LTC_TIMING_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
 /**
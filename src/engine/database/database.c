@@ -47,20 +47,46 @@
 #include "os.h"
 #include "enginetask.h"
 #include "diag.h"
+#include "mcu.h"
+#include "mcu_cfg.h"
+#include "misc.h"
+#include "uart.h"
 #include "string.h"
 
 /*================== Macros and Definitions ===============================*/
 /**
- * Maximum queue timeout time in milliseconds
+ * Maximum queue timeout time in milliseconds, also used as mutex timeout of the writers for DATA_SEQLOCK_ACCESS
  */
 #define DATA_QUEUE_TIMEOUT_MS   10
 
+/**
+ * index of the buffer of a data block a pointer points to
+ */
+#define DATA_BUFFER_INDEX(headerptr, bufferptr)   ((uint8_t)(((uint8_t*)(bufferptr) - (uint8_t*)(headerptr)->blockptr) / (headerptr)->datalength))
+
 /*================== Constant and Variable Definitions ====================*/
 // FIXME Some uninitialized variables
 static DATA_BASE_HEADER_DEV_s *data_block_devptr = (DATA_BASE_HEADER_DEV_s *)NULL_PTR;
 static DATA_BLOCK_ACCESS_s data_block_access[DATA_MAX_BLOCK_NR];
 static osMutexId data_base_mutex[DATA_MAX_BLOCK_NR];
 
+/**
+ * sequence counter of each data block
+ * TRIPLE_BUFFERING: number of stored buffers (plus one for each store into a newer buffer)
+ * DATA_SEQLOCK_ACCESS: odd while the RDptr or the buffer behind it is changed
+ */
+static volatile uint32_t data_block_seq[DATA_MAX_BLOCK_NR];
+
+/**
+ * number of borrowers (DATA_BorrowTable()) of each buffer of triple buffered data blocks
+ */
+static uint8_t data_block_borrowed[DATA_MAX_BLOCK_NR][TRIPLE_BUFFERING];
+
+/**
+ * version of each data block, incremented every time the data block is stored
+ */
+static volatile uint32_t data_block_version[DATA_MAX_BLOCK_NR];
+
 /**
  * state of database task: 0: not initialized,     1:  database ready
  */
@@ -68,15 +94,192 @@ static uint8_t data_state = 0;
 
 
 
+#if DATA_PROFILING == TRUE
+/**
+ * statistics of the database accesses
+ */
+static DATA_PROFILE_s data_profile;
+#endif
+
 /*================== Function Prototypes ==================================*/
 static void DATA_Init(DATA_BASE_HEADER_DEV_s* devptr);
+static STD_RETURN_TYPE_e DATA_StoreTripleBuffer(void *srcdataptr, DATA_BLOCK_ID_TYPE_e blockID);
+static STD_RETURN_TYPE_e DATA_ReadTripleBuffer(void *dstdataptr, DATA_BLOCK_ID_TYPE_e blockID);
+static void DATA_Publish(DATA_BLOCK_ID_TYPE_e blockID);
+#if DATA_PROFILING == TRUE
+static void DATA_ProfileCaller(uint32_t starttime_us, uint8_t accepted);
+static void DATA_ProfileBlock(DATA_BLOCK_ID_TYPE_e blockID, DATA_BLOCK_ACCESS_TYPE_e accesstype, uint8_t copied, uint32_t requesttime_us);
+#endif
 
 /*================== Function Implementations =============================*/
 
 /*================== Public functions =====================================*/
 
-void DATA_StoreDataBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID)
+#if DATA_SEQLOCK_ACCESS == TRUE
+STD_RETURN_TYPE_e DATA_StoreDataBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID)
+{
+    void *dstdataptr;
+    uint16_t datalength;
+    DATA_BLOCK_CONSISTENCY_TYPE_e buffertype;
+    TickType_t mutextimeout;
+    uint8_t copied = FALSE;
+#if DATA_PROFILING == TRUE
+    uint32_t starttime_us = MCU_GetTime_us();
+#endif
+
+    if( vPortCheckCriticalSection() )
+    {
+        configASSERT(0);
+    }
+
+    if((data_state == 0) || (blockID >= DATA_MAX_BLOCK_NR) || (dataptrfromSender == NULL_PTR))
+    {   /* the database is not initialized yet (DATA_Task() has not run) or the request is invalid */
+#if DATA_PROFILING == TRUE
+        DATA_ProfileCaller(starttime_us, FALSE);
+#endif
+        return E_NOT_OK;
+    }
+
+    mutextimeout = DATA_QUEUE_TIMEOUT_MS / portTICK_RATE_MS;
+    if (mutextimeout  ==  0)
+    {
+        mutextimeout = 1;
+    }
+
+    datalength = (data_block_devptr->blockheaderptr + blockID)->datalength;
+    buffertype = (data_block_devptr->blockheaderptr + blockID)->buffertype;
+
+    if(buffertype  ==  TRIPLE_BUFFERING)
+    {
+        copied = (DATA_StoreTripleBuffer(dataptrfromSender, blockID) == E_OK);
+    }
+    /* the mutex only serializes the writers, the readers never take it */
+    else if(xSemaphoreTake(data_base_mutex[blockID], mutextimeout)  ==  TRUE)
+    {
+        dstdataptr = data_block_access[blockID].WRptr;
+        if(buffertype  ==  DOUBLE_BUFFERING)
+        {   /* WRptr is not published, so the copy does not disturb the readers of RDptr.
+               Only the swap changes the sequence counter. */
+            memcpy(dstdataptr, dataptrfromSender, datalength);
+            taskENTER_CRITICAL();
+            data_block_seq[blockID]++;
+            __DMB();
+            data_block_access[blockID].WRptr = data_block_access[blockID].RDptr;
+            data_block_access[blockID].RDptr = dstdataptr;
+            __DMB();
+            data_block_seq[blockID]++;
+            taskEXIT_CRITICAL();
+        }
+        else
+        {   /* the only buffer is written, readers retry or give up */
+            data_block_seq[blockID]++;
+            __DMB();
+            memcpy(dstdataptr, dataptrfromSender, datalength);
+            __DMB();
+            data_block_seq[blockID]++;
+        }
+        xSemaphoreGive(data_base_mutex[blockID]);
+        copied = TRUE;
+    }
+
+    if(copied == TRUE)
+    {
+        DATA_Publish(blockID);
+    }
+
+#if DATA_PROFILING == TRUE
+    DATA_ProfileCaller(starttime_us, TRUE);
+    DATA_ProfileBlock(blockID, WRITE_ACCESS, copied, starttime_us);
+#endif
+
+    return (copied == TRUE) ? E_OK : E_NOT_OK;
+}
+
+
+void DATA_Task(void) {
+
+    if(data_state == 0)
+    {
+        DATA_Init(&data_base_dev);
+        data_state=1;
+    }
+
+    /* no requests to process, but the engine task must not starve the tasks with lower priority */
+    osDelay(1);
+    DIAG_SysMonNotify(DIAG_SYSMON_DATABASE_ID, 0);        // task is running, state = ok
+}
+
+
+STD_RETURN_TYPE_e DATA_GetTable(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID)
+{
+    STD_RETURN_TYPE_e retval = E_NOT_OK;
+    uint32_t seq;
+    uint8_t retries;
+    uint16_t datalength;
+#if DATA_PROFILING == TRUE
+    uint32_t starttime_us = MCU_GetTime_us();
+#endif
+
+    if(vPortCheckCriticalSection())
+    {
+        configASSERT(0);
+    }
+
+    if((data_state == 0) || (blockID >= DATA_MAX_BLOCK_NR) || (dataptrtoReceiver == NULL_PTR))
+    {
+        return E_NOT_OK;
+    }
+
+    datalength = (data_block_devptr->blockheaderptr + blockID)->datalength;
+
+    if((data_block_devptr->blockheaderptr + blockID)->buffertype  ==  TRIPLE_BUFFERING)
+    {
+        retval = DATA_ReadTripleBuffer(dataptrtoReceiver, blockID);
+    }
+    else
+    {
+        /* the copy is consistent if the sequence counter was even and did not change meanwhile */
+        for(retries = 0; (retries < DATA_SEQLOCK_MAX_RETRIES) && (retval == E_NOT_OK); retries++)
+        {
+            seq = data_block_seq[blockID];
+            __DMB();
+            if((seq & 0x01) == 0)
+            {
+                memcpy(dataptrtoReceiver, data_block_access[blockID].RDptr, datalength);
+                __DMB();
+                if(data_block_seq[blockID]  ==  seq)
+                {
+                    retval = E_OK;
+                }
+            }
+        }
+
+        if(retval == E_NOT_OK)
+        {   /* the data block is stored faster than it is read: the last copy is made in a critical
+               section instead of holding the mutex, so a preempted reader never blocks the writers.
+               It only fails while a single buffered data block is written by an interrupted writer. */
+            taskENTER_CRITICAL();
+            if((data_block_seq[blockID] & 0x01) == 0)
+            {
+                memcpy(dataptrtoReceiver, data_block_access[blockID].RDptr, datalength);
+                retval = E_OK;
+            }
+            taskEXIT_CRITICAL();
+        }
+    }
+
+#if DATA_PROFILING == TRUE
+    DATA_ProfileCaller(starttime_us, TRUE);
+    DATA_ProfileBlock(blockID, READ_ACCESS, (retval == E_OK), starttime_us);
+#endif
+
+    return retval;
+}
+
+#else
+STD_RETURN_TYPE_e DATA_StoreDataBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID)
 {
+    STD_RETURN_TYPE_e retval = E_NOT_OK;
     // dataptrfromSender is a pointer to data of caller function
     // dataptr_toptr_fromSender is a pointer to this pointer
     // this is used for passing message variable by reference
@@ -99,9 +302,34 @@ void DATA_StoreDataBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID)
     data_send_msg.blockID = blockID;
     data_send_msg.value.voidptr = dataptrfromSender;
     data_send_msg.accesstype = WRITE_ACCESS;
+#if DATA_PROFILING == TRUE
+    data_send_msg.timestamp_us = MCU_GetTime_us();
+    if(uxQueueMessagesWaiting(data_queueID) + 1 > data_profile.queue_highwater)
+    {
+        data_profile.queue_highwater = uxQueueMessagesWaiting(data_queueID) + 1;
+    }
+#endif
     // Send a pointer to a message object and
     // maximum block time: queuetimeout
-    xQueueSend( data_queueID, (void *) &data_send_msg, queuetimeout);
+#if DATA_PROFILING == TRUE
+    if(xQueueSend( data_queueID, (void *) &data_send_msg, queuetimeout) == pdTRUE)
+    {
+        DATA_ProfileCaller(data_send_msg.timestamp_us, TRUE);
+        retval = E_OK;
+    }
+    else
+    {   /* the request was dropped */
+        DATA_ProfileCaller(data_send_msg.timestamp_us, FALSE);
+        DATA_ProfileBlock(blockID, WRITE_ACCESS, FALSE, data_send_msg.timestamp_us);
+    }
+#else
+    if(xQueueSend( data_queueID, (void *) &data_send_msg, queuetimeout) == pdTRUE)
+    {
+        retval = E_OK;
+    }
+#endif
+
+    return retval;
  }
 
 
@@ -113,6 +341,7 @@ void DATA_Task(void) {
     DATA_BLOCK_ACCESS_TYPE_e    accesstype; /* read or write access type */
     uint16_t datalength;
     DATA_BLOCK_CONSISTENCY_TYPE_e buffertype;
+    uint8_t copied = FALSE;
 
     if(data_state == 0)
     {
@@ -136,11 +365,16 @@ void DATA_Task(void) {
                     buffertype = (data_block_devptr->blockheaderptr + blockID)->buffertype;
                     dstdataptr=data_block_access[blockID].WRptr;
 
+                    if(buffertype  ==  TRIPLE_BUFFERING)
+                    {   /* the writer has a free buffer unless two buffers are borrowed, no need to check for read accesses */
+                        copied = (DATA_StoreTripleBuffer(srcdataptr, blockID) == E_OK);
+                    }
                     /* Check if there any read accesses taking place (in tasks with lower priorities)*/
-                    if(xSemaphoreTake(data_base_mutex[blockID], 0)  ==  TRUE)
+                    else if(xSemaphoreTake(data_base_mutex[blockID], 0)  ==  TRUE)
                     {
                         memcpy(dstdataptr, srcdataptr, datalength);
                         xSemaphoreGive(data_base_mutex[blockID]);
+                        copied = TRUE;
                         if(buffertype  ==  DOUBLE_BUFFERING)
                         {   /* swap the WR and RD pointers:
                                WRptr always points to buffer to be written next time and changed afterwards
@@ -169,6 +403,7 @@ void DATA_Task(void) {
                             {
                                 memcpy(dstdataptr, srcdataptr, datalength);
                                 xSemaphoreGive(data_base_mutex[blockID]);
+                                copied = TRUE;
                             }
                         }
                     }
@@ -178,13 +413,25 @@ void DATA_Task(void) {
                             if(srcdataptr != NULL_PTR)
                             {
                                 memcpy(dstdataptr, srcdataptr, datalength);
+                                copied = TRUE;
                             }
                     }
+                    else if(buffertype  ==  TRIPLE_BUFFERING)
+                    {
+                        copied = (DATA_ReadTripleBuffer(dstdataptr, blockID) == E_OK);
+                    }
                 }
                 else
                 {
                     ;
                 }
+                if((accesstype == WRITE_ACCESS) && (copied == TRUE))
+                {
+                    DATA_Publish(blockID);
+                }
+#if DATA_PROFILING == TRUE
+                DATA_ProfileBlock(blockID, accesstype, copied, receive_msg.timestamp_us);
+#endif
             }
         }
         DIAG_SysMonNotify(DIAG_SYSMON_DATABASE_ID, 0);        // task is running, state = ok
@@ -212,24 +459,173 @@ STD_RETURN_TYPE_e DATA_GetTable(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  b
     data_send_msg.blockID = blockID;
     data_send_msg.value.voidptr = dataptrtoReceiver;
     data_send_msg.accesstype = READ_ACCESS;
+#if DATA_PROFILING == TRUE
+    data_send_msg.timestamp_us = MCU_GetTime_us();
+    if(uxQueueMessagesWaiting(data_queueID) + 1 > data_profile.queue_highwater)
+    {
+        data_profile.queue_highwater = uxQueueMessagesWaiting(data_queueID) + 1;
+    }
+#endif
 
 
  
     // Send a pointer to a message object and
     // maximum block time: queuetimeout
+#if DATA_PROFILING == TRUE
+    if(xQueueSend( data_queueID, (void *) &data_send_msg, queuetimeout) == pdTRUE)
+    {
+        DATA_ProfileCaller(data_send_msg.timestamp_us, TRUE);
+    }
+    else
+    {   /* the request was dropped */
+        DATA_ProfileCaller(data_send_msg.timestamp_us, FALSE);
+        DATA_ProfileBlock(blockID, READ_ACCESS, FALSE, data_send_msg.timestamp_us);
+    }
+#else
     xQueueSend( data_queueID, (void *) &data_send_msg, queuetimeout);
+#endif
 
 
 
     return E_OK;
 }
+#endif
 
-// FIXME not used  currently - delete?
-void * DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_TYPE_e  blockID) {
-    //FIXME block with semaphore
-    return data_block_access[blockID].RDptr;
+const void * DATA_BorrowTable(DATA_BLOCK_ID_TYPE_e  blockID) {
+    const void *dataptr;
+    DATA_BASE_HEADER_s *headerptr;
+
+    if((data_state == 0) || (blockID >= DATA_MAX_BLOCK_NR)) {
+        return NULL_PTR;
+    }
+    headerptr = data_block_devptr->blockheaderptr + blockID;
+    if(headerptr->buffertype != TRIPLE_BUFFERING) {
+        return NULL_PTR;
+    }
+
+    /* the writer must not publish another buffer between reading RDptr and counting the borrower */
+    taskENTER_CRITICAL();
+    dataptr = data_block_access[blockID].RDptr;
+    data_block_borrowed[blockID][DATA_BUFFER_INDEX(headerptr, dataptr)]++;
+    taskEXIT_CRITICAL();
+
+    return dataptr;
 }
 
+
+void DATA_ReturnTable(DATA_BLOCK_ID_TYPE_e  blockID, const void *dataptr) {
+    DATA_BASE_HEADER_s *headerptr;
+    uint8_t buffer;
+
+    if((data_state == 0) || (blockID >= DATA_MAX_BLOCK_NR) || (dataptr == NULL_PTR)) {
+        return;
+    }
+    headerptr = data_block_devptr->blockheaderptr + blockID;
+    buffer = DATA_BUFFER_INDEX(headerptr, dataptr);
+    if((headerptr->buffertype != TRIPLE_BUFFERING) || (buffer >= TRIPLE_BUFFERING)) {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    if(data_block_borrowed[blockID][buffer] > 0) {
+        data_block_borrowed[blockID][buffer]--;
+    }
+    taskEXIT_CRITICAL();
+}
+
+uint32_t DATA_GetVersion(DATA_BLOCK_ID_TYPE_e blockID) {
+    uint32_t version = 0;
+
+    if(blockID < DATA_MAX_BLOCK_NR) {
+        version = data_block_version[blockID];
+    }
+
+    return version;
+}
+
+
+STD_RETURN_TYPE_e DATA_GetTableIfNew(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID, uint32_t *versionptr) {
+    uint32_t version = DATA_GetVersion(blockID);
+
+    if((versionptr == NULL_PTR) || (version == *versionptr)) {
+        return E_NOT_OK;
+    }
+
+    if(DATA_GetTable(dataptrtoReceiver, blockID) != E_OK) {
+        return E_NOT_OK;
+    }
+    *versionptr = version;
+
+    return E_OK;
+}
+
+
+#if DATA_PROFILING == TRUE
+void DATA_GetProfile(DATA_PROFILE_s *profileptr) {
+    taskENTER_CRITICAL();
+    memcpy(profileptr, &data_profile, sizeof(DATA_PROFILE_s));
+    taskEXIT_CRITICAL();
+}
+
+
+void DATA_ResetProfile(void) {
+    taskENTER_CRITICAL();
+    memset(&data_profile, 0, sizeof(DATA_PROFILE_s));
+    taskEXIT_CRITICAL();
+}
+
+
+void DATA_PrintProfile(void) {
+    static DATA_PROFILE_s profile;
+    uint8_t buf[12] = {0,0,0,0,0,0,0,0,0,0,0,0};   // I32ToDecascii() does not terminate the string, UART_vWrite() clears it
+    uint32_t c;
+
+    DATA_GetProfile(&profile);
+
+    DEBUG_PRINTF((const uint8_t * )"Database blocks: reads / writes / dropped writes / failed reads / bytes\r\n");
+    for(c = 0; c < DATA_MAX_BLOCK_NR; c++) {
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&c));
+        DEBUG_PRINTF((const uint8_t * )": ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.block[c].reads));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.block[c].writes));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.block[c].dropped_writes));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.block[c].failed_reads));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.block[c].bytes_copied));
+        DEBUG_PRINTF((const uint8_t * )"\r\n");
+    }
+
+    DEBUG_PRINTF((const uint8_t * )"Database callers: priority / requests / rejected / wait sum us / wait max us\r\n");
+    for(c = 0; (c < DATA_PROFILING_NR_OF_CALLERS) && (profile.caller[c].task != NULL_PTR); c++) {
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.caller[c].priority));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.caller[c].requests));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.caller[c].rejected));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.caller[c].wait_sum_us));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.caller[c].wait_max_us));
+        DEBUG_PRINTF((const uint8_t * )"\r\n");
+    }
+    DEBUG_PRINTF((const uint8_t * )"unassigned requests: ");
+    DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.unassigned_requests));
+    DEBUG_PRINTF((const uint8_t * )"\r\nqueue high-water mark: ");
+    DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.queue_highwater));
+    DEBUG_PRINTF((const uint8_t * )"\r\nlatency max us: ");
+    DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.latency_max_us));
+    DEBUG_PRINTF((const uint8_t * )"\r\nlatency histogram:");
+    for(c = 0; c < DATA_PROFILING_NR_OF_BINS; c++) {
+        DEBUG_PRINTF((const uint8_t * )" ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&profile.latency_histogram[c]));
+    }
+    DEBUG_PRINTF((const uint8_t * )"\r\n");
+}
+#endif
+
 /*================== Static functions =====================================*/
 
 /**
@@ -271,6 +667,11 @@ static void DATA_Init(DATA_BASE_HEADER_DEV_s *devptr) {
             // FIXME a comment would be good to understand the pointer magic here
             data_block_access[c].RDptr = (void*)((uint32_t)data_block_access[c].WRptr + (devptr->blockheaderptr + c)->datalength);
         }
+        else if((devptr->blockheaderptr + c)->buffertype  ==  TRIPLE_BUFFERING)
+        {   /* the first buffer is published (empty data), the second one is written next */
+            data_block_access[c].RDptr = data_block_access[c].WRptr;
+            data_block_access[c].WRptr = (void*)((uint32_t)data_block_access[c].RDptr + (devptr->blockheaderptr + c)->datalength);
+        }
         else
         {
             data_block_access[c].RDptr = data_block_access[c].WRptr;
@@ -279,3 +680,194 @@ static void DATA_Init(DATA_BASE_HEADER_DEV_s *devptr) {
     }
 
 }
+
+
+/**
+ * @brief   Stores a triple buffered data block
+ *
+ * The data is copied to the oldest buffer, which is published afterwards. The published buffer
+ * is written again after two further calls, so the writer never waits for the readers.
+ * If the oldest buffer is borrowed (DATA_BorrowTable()), the other unpublished buffer is used.
+ *
+ * @param   srcdataptr (type: void *) pointer to the data of the sender
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ *
+ * @return  E_OK if the data was stored, E_NOT_OK if both unpublished buffers are borrowed
+ */
+static STD_RETURN_TYPE_e DATA_StoreTripleBuffer(void *srcdataptr, DATA_BLOCK_ID_TYPE_e blockID) {
+    DATA_BASE_HEADER_s *headerptr = data_block_devptr->blockheaderptr + blockID;
+    uint8_t *dstdataptr = (uint8_t*)data_block_access[blockID].WRptr;
+    uint8_t rdbuffer = DATA_BUFFER_INDEX(headerptr, data_block_access[blockID].RDptr);
+    uint8_t wrbuffer = DATA_BUFFER_INDEX(headerptr, dstdataptr);
+
+    /* only the published buffer can get borrowed, so the check does not need a critical section */
+    if(data_block_borrowed[blockID][wrbuffer] > 0)
+    {
+        wrbuffer = (0 + 1 + 2) - rdbuffer - wrbuffer;
+        if(data_block_borrowed[blockID][wrbuffer] > 0)
+        {
+            return E_NOT_OK;
+        }
+        dstdataptr = (uint8_t*)headerptr->blockptr + wrbuffer*headerptr->datalength;
+        /* this buffer was published one call later than the oldest one, the additional count
+           lets the readers of DATA_ReadTripleBuffer() detect the earlier overwrite */
+        data_block_seq[blockID]++;
+        __DMB();
+    }
+
+    memcpy(dstdataptr, srcdataptr, headerptr->datalength);
+    __DMB();
+    /* RDptr has to be written before the sequence counter: a reader which still gets the old
+       counter value with the new RDptr checks against the later overwrite of the new buffer */
+    data_block_access[blockID].RDptr = dstdataptr;
+    __DMB();
+    data_block_seq[blockID]++;
+
+    /* the next buffer is the oldest one: neither the new nor the previously published one */
+    wrbuffer = (0 + 1 + 2) - rdbuffer - wrbuffer;
+    data_block_access[blockID].WRptr = (uint8_t*)headerptr->blockptr + wrbuffer*headerptr->datalength;
+
+    return E_OK;
+}
+
+
+/**
+ * @brief   Reads the newest buffer of a triple buffered data block
+ *
+ * The buffer is written again after two further buffers were stored, the copy is retried
+ * if this happened meanwhile (reader interrupted for a long time).
+ *
+ * @param   dstdataptr (type: void *) pointer to the data of the receiver
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ *
+ * @return  E_OK if the copy is consistent, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e DATA_ReadTripleBuffer(void *dstdataptr, DATA_BLOCK_ID_TYPE_e blockID) {
+    STD_RETURN_TYPE_e retval = E_NOT_OK;
+    uint16_t datalength = (data_block_devptr->blockheaderptr + blockID)->datalength;
+    uint32_t seq;
+    uint8_t retries;
+
+    for(retries = 0; (retries < DATA_SEQLOCK_MAX_RETRIES) && (retval == E_NOT_OK); retries++)
+    {
+        seq = data_block_seq[blockID];
+        __DMB();
+        memcpy(dstdataptr, data_block_access[blockID].RDptr, datalength);
+        __DMB();
+        if((uint32_t)(data_block_seq[blockID] - seq) < 2)
+        {
+            retval = E_OK;
+        }
+    }
+
+    return retval;
+}
+
+
+/**
+ * @brief   Publishes a stored data block
+ *
+ * Increments the version of the data block.
+ *
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ *
+ * @return  void
+ */
+static void DATA_Publish(DATA_BLOCK_ID_TYPE_e blockID) {
+
+    /* several writers may publish the same data block (DATA_SEQLOCK_ACCESS): the increment must be atomic */
+    taskENTER_CRITICAL();
+    data_block_version[blockID]++;
+    taskEXIT_CRITICAL();
+}
+
+
+#if DATA_PROFILING == TRUE
+/**
+ * @brief   Counts a request in the statistics of the calling task
+ *
+ * @param   starttime_us (type: uint32_t) time of the call, unit: us
+ * @param   accepted (type: uint8_t) FALSE if the request was dropped
+ *
+ * @return  void
+ */
+static void DATA_ProfileCaller(uint32_t starttime_us, uint8_t accepted) {
+    uint32_t wait_us = MCU_GetTime_us() - starttime_us;
+    void *task = xTaskGetCurrentTaskHandle();
+    DATA_PROFILE_CALLER_s *callerptr = NULL_PTR;
+    uint8_t c;
+
+    taskENTER_CRITICAL();
+    for(c = 0; (c < DATA_PROFILING_NR_OF_CALLERS) && (callerptr == NULL_PTR); c++) {
+        if((data_profile.caller[c].task == task) || (data_profile.caller[c].task == NULL_PTR)) {
+            callerptr = &data_profile.caller[c];
+        }
+    }
+
+    if(callerptr == NULL_PTR) {
+        data_profile.unassigned_requests++;
+    }
+    else {
+        if(callerptr->task == NULL_PTR) {
+            callerptr->task = task;
+            callerptr->priority = uxTaskPriorityGet(NULL);
+        }
+        callerptr->requests++;
+        if(accepted == FALSE) {
+            callerptr->rejected++;
+        }
+        callerptr->wait_sum_us += wait_us;
+        if(wait_us > callerptr->wait_max_us) {
+            callerptr->wait_max_us = wait_us;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+
+/**
+ * @brief   Counts an access in the statistics of the data block
+ *
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ * @param   accesstype (type: DATA_BLOCK_ACCESS_TYPE_e)
+ * @param   copied (type: uint8_t) FALSE if the data block was not copied
+ * @param   requesttime_us (type: uint32_t) time of the request, unit: us
+ *
+ * @return  void
+ */
+static void DATA_ProfileBlock(DATA_BLOCK_ID_TYPE_e blockID, DATA_BLOCK_ACCESS_TYPE_e accesstype, uint8_t copied, uint32_t requesttime_us) {
+    uint32_t latency_us = MCU_GetTime_us() - requesttime_us;
+    uint32_t bin = latency_us / DATA_PROFILING_BIN_US;
+    DATA_PROFILE_BLOCK_s *blockptr;
+
+    if(blockID >= DATA_MAX_BLOCK_NR) {
+        return;
+    }
+    if(bin >= DATA_PROFILING_NR_OF_BINS) {
+        bin = DATA_PROFILING_NR_OF_BINS - 1;
+    }
+    blockptr = &data_profile.block[blockID];
+
+    taskENTER_CRITICAL();
+    if(accesstype == WRITE_ACCESS) {
+        blockptr->writes++;
+        if(copied == FALSE) {
+            blockptr->dropped_writes++;
+        }
+    }
+    else {
+        blockptr->reads++;
+        if(copied == FALSE) {
+            blockptr->failed_reads++;
+        }
+    }
+    if(copied == TRUE) {
+        blockptr->bytes_copied += (data_block_devptr->blockheaderptr + blockID)->datalength;
+        data_profile.latency_histogram[bin]++;
+        if(latency_us > data_profile.latency_max_us) {
+            data_profile.latency_max_us = latency_us;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+#endif
@@ -54,6 +54,9 @@ typedef struct
     } value;
     DATA_BLOCK_ID_TYPE_e        blockID;    /* definition of used message data type */
     DATA_BLOCK_ACCESS_TYPE_e    accesstype; /* read or write access type */
+#if DATA_PROFILING == TRUE
+    uint32_t                    timestamp_us;   /* time of the request, unit: us */
+#endif
 } DATA_QUEUE_MESSAGE_s;
 
 
@@ -65,6 +68,41 @@ typedef struct
 
 } DATA_BLOCK_ACCESS_s;
 
+/**
+ * access statistics of a data block
+ */
+typedef struct {
+    uint32_t reads;             /*!< requested read accesses                                                */
+    uint32_t writes;            /*!< requested write accesses                                               */
+    uint32_t dropped_writes;    /*!< write accesses without copy (mutex not taken or request not queued)   */
+    uint32_t failed_reads;      /*!< read accesses without consistent copy                                  */
+    uint32_t bytes_copied;      /*!< copied bytes of all accesses                                           */
+} DATA_PROFILE_BLOCK_s;
+
+/**
+ * access statistics of a calling task
+ */
+typedef struct {
+    void *task;                 /*!< task handle, NULL_PTR if the entry is not used                         */
+    uint32_t priority;          /*!< priority of the task                                                   */
+    uint32_t requests;          /*!< calls of DATA_StoreDataBlock() and DATA_GetTable()                     */
+    uint32_t rejected;          /*!< requests which were not queued within the timeout                      */
+    uint32_t wait_sum_us;       /*!< time spent in the calls (waiting for the queue), unit: us              */
+    uint32_t wait_max_us;       /*!< longest call, unit: us                                                 */
+} DATA_PROFILE_CALLER_s;
+
+/**
+ * statistics of the database accesses
+ */
+typedef struct {
+    DATA_PROFILE_BLOCK_s block[DATA_MAX_BLOCK_NR];
+    DATA_PROFILE_CALLER_s caller[DATA_PROFILING_NR_OF_CALLERS];
+    uint32_t unassigned_requests;   /*!< requests of tasks without caller entry                             */
+    uint32_t queue_highwater;       /*!< maximum number of queued requests including the new one            */
+    uint32_t latency_max_us;        /*!< longest time from request to copy, unit: us                        */
+    uint32_t latency_histogram[DATA_PROFILING_NR_OF_BINS];  /*!< requests per DATA_PROFILING_BIN_US         */
+} DATA_PROFILE_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
 
@@ -72,26 +110,52 @@ typedef struct
 /*================== Function Prototypes ==================================*/
 /**
  * @brief   Stores a datablock in database
+ *
+ * With DATA_SEQLOCK_ACCESS the data is copied before the function returns, otherwise the
+ * database task copies it later.
+ *
  * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
  * @param   dataptrfromSender (type: void *)
- * @return  void
+ * @return  E_NOT_OK if the data was not stored (DATA_SEQLOCK_ACCESS: database not initialized yet
+ *          or mutex not taken) or the request was not queued, otherwise E_OK
  */
-extern void DATA_StoreDataBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID);
+extern STD_RETURN_TYPE_e DATA_StoreDataBlock(void *dataptrfromSender, DATA_BLOCK_ID_TYPE_e  blockID);
 
 /**
  * @brief   Reads a datablock in database by value
+ *
+ * With DATA_SEQLOCK_ACCESS the data is copied before the function returns and E_NOT_OK is
+ * returned if no consistent copy was made (the content of the receiver is undefined then).
+ * Without DATA_SEQLOCK_ACCESS the copy is only queued: the database task copies the data block
+ * later, so the receiver must stay valid after the call and holds the data only after the
+ * database task has run. Modules which evaluate the data within the same call need
+ * DATA_SEQLOCK_ACCESS.
+ *
  * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
  * @param   dataptrtoReceiver (type: void *)
- * @return  STD_RETURN_TYPE_e
+ * @return  E_OK if the data was copied (DATA_SEQLOCK_ACCESS) or the request was queued, otherwise E_NOT_OK
  */
 extern STD_RETURN_TYPE_e DATA_GetTable(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID);
 
- /**
- * @brief   Gets a pointer to datablock in database ()
+/**
+ * @brief   Borrows the newest buffer of a triple buffered datablock without copying it
+ *
+ * The buffer is not written until it is returned with DATA_ReturnTable(). The writer uses the
+ * other buffers meanwhile, stores are dropped if the two other buffers are borrowed as well.
+ * Borrowed buffers must be returned quickly (e.g., within the same task cycle).
+ *
  * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
- * @return  void* RDptr
-  */
-extern void * DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_TYPE_e  blockID);
+ * @return  pointer to the data, NULL_PTR if the data block is not triple buffered
+ */
+extern const void * DATA_BorrowTable(DATA_BLOCK_ID_TYPE_e  blockID);
+
+/**
+ * @brief   Returns a buffer borrowed with DATA_BorrowTable()
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ * @param   dataptr (type: const void *) pointer returned by DATA_BorrowTable()
+ * @return  void
+ */
+extern void DATA_ReturnTable(DATA_BLOCK_ID_TYPE_e  blockID, const void *dataptr);
 
  /**
   * @brief   trigger of database manager
@@ -100,6 +164,47 @@ extern void * DATA_GetTablePtrBeginCritical(DATA_BLOCK_ID_TYPE_e  blockID);
   */
  extern void DATA_Task(void);
 
+/**
+ * @brief   Gets the version of a data block, which is incremented every time the data block is stored
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ * @return  version of the data block
+ */
+extern uint32_t DATA_GetVersion(DATA_BLOCK_ID_TYPE_e blockID);
+
+/**
+ * @brief   Reads a datablock in database by value if it was stored since the last call
+ *
+ * Nothing is copied if the version of the data block equals *versionptr. Otherwise the data
+ * block is read with DATA_GetTable() and *versionptr is set to the version before the copy,
+ * so a version stored during the copy is read again with the next call.
+ * Without DATA_SEQLOCK_ACCESS the copy is only queued (see DATA_GetTable()).
+ *
+ * @param   dataptrtoReceiver (type: void *)
+ * @param   blockID (type: DATA_BLOCK_ID_TYPE_e)
+ * @param   versionptr (type: uint32_t *) version of the last read data, updated by the function
+ * @return  E_OK if new data was read, E_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e DATA_GetTableIfNew(void *dataptrtoReceiver, DATA_BLOCK_ID_TYPE_e  blockID, uint32_t *versionptr);
+
+/**
+ * @brief   Gets the statistics of the database accesses (only with DATA_PROFILING)
+ * @param   profileptr (type: DATA_PROFILE_s *) pointer to the copy of the statistics
+ * @return  void
+ */
+extern void DATA_GetProfile(DATA_PROFILE_s *profileptr);
+
+/**
+ * @brief   Resets the statistics of the database accesses (only with DATA_PROFILING)
+ * @return  void
+ */
+extern void DATA_ResetProfile(void);
+
+/**
+ * @brief   Prints the statistics of the database accesses over UART (only with DATA_PROFILING)
+ * @return  void
+ */
+extern void DATA_PrintProfile(void);
+
 /*================== Function Implementations =============================*/
 
 
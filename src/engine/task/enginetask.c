@@ -33,6 +33,7 @@
 /*================== Includes =============================================*/
 #include "enginetask.h"
 #include "ltc.h"
+#include "ltc_sim.h"
 #include "syscontrol.h"
 #include "bmsctrl.h"
 #include "can.h"
@@ -61,8 +62,14 @@ void ENG_Init(void) {
 
 void ENG_TSK_Cyclic_1ms(void) {
     BMSCTRL_Trigger();
+#if LTC_SIMULATION == TRUE
+    LTC_SIM_BenchmarkStart();
+#endif
     LTC_Ctrl(LTC_HAS_TO_MEASURE);
     LTC_Trigger();
+#if LTC_SIMULATION == TRUE
+    LTC_SIM_BenchmarkStop();
+#endif
 }
 
 void ENG_TSK_Cyclic_10ms(void) {
@@ -214,6 +214,7 @@ uint32_t cans_setcurr(uint32_t sigIdx, void *value) {
                         | dummy[1] << 16 | dummy[0] << 24);
                 cans_current_tab.previous_timestamp = cans_current_tab.timestamp;
                 cans_current_tab.timestamp = MCU_GetTimeStamp();
+                cans_current_tab.timestamp_us = MCU_GetTime_us();
                 cans_current_tab.current=(float)(currentValue);
                 cans_current_tab.state_current++;
                 DATA_StoreDataBlock(&cans_current_tab,DATA_BLOCK_ID_CURRENT);
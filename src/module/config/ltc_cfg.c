@@ -46,6 +46,117 @@
 
 /*================== Constant and Variable Definitions ====================*/
 
+#if LTC_MUX_MULTI_GPIO == TRUE
+/**
+ * Multiplexer measurement sequence for LTC_MUX_MULTI_GPIO
+ * The temperature multiplexer 0 and the balancing feedback multiplexer 2 are connected to
+ * different GPIOs, so each pair of consecutive steps (0,x),(2,x) is measured with one conversion.
+ * Must be adapted to the application
+ */
+LTC_MUX_CH_CFG_s ltc_mux_seq_main_ch1[] = {
+    {
+        .muxID    = 1,
+        .muxCh    = 0xFF,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 0xFF,   // disable enabled mux
+    },
+    {
+        .muxID    = 0,
+        .muxCh    = 0,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 0,
+    },
+    {
+        .muxID    = 0,
+        .muxCh    = 1,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 1,
+    },
+    {
+        .muxID    = 0,
+        .muxCh    = 2,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 2,
+    },
+    {
+        .muxID    = 0,
+        .muxCh    = 3,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 3,
+    },
+    {
+        .muxID    = 0,
+        .muxCh    = 4,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 4,
+    },
+    {
+        .muxID    = 0,
+        .muxCh    = 5,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 5,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 6,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 7,
+    },
+    {
+        .muxID    = 2,
+        .muxCh    = 0xFF,   // disable enabled mux
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 0,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 1,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 2,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 3,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 4,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 5,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 6,
+    },
+    {
+        .muxID    = 3,
+        .muxCh    = 7,
+    }
+
+};
+#else
 /**
  * Default multiplexer measurement sequence
  * Must be adapted to the application
@@ -165,6 +276,7 @@ LTC_MUX_CH_CFG_s ltc_mux_seq_main_ch1[] = {
     }
 
 };
+#endif
 
 
 LTC_MUX_SEQUENZ_s ltc_mux_seq = {
@@ -173,23 +285,34 @@ LTC_MUX_SEQUENZ_s ltc_mux_seq = {
 };
 
 
-const uint8_t ltc_muxsensortemperatur_cfg[6] = {
-    1-1 ,       /*!< index 0 = mux 0, ch 0 */
-    2-1 ,       /*!< index 1 = mux 0, ch 1 */
-    3-1 ,       /*!< index 2 = mux 0, ch 2 */
-    4-1 ,       /*!< index 3 = mux 0, ch 3 */
-    5-1 ,       /*!< index 4 = mux 0, ch 4 */
-    6-1 ,       /*!< index 5 = mux 0, ch 5 */
-    //7-1 ,     /*!< index 6 = mux 0, ch 6 */
-    //8-1 ,     /*!< index 7 = mux 0, ch 7 */
-    //9-1 ,     /*!< index 8 = mux 1, ch 0 */
-    //10-1 ,    /*!< index 9 = mux 1, ch 1 */
-    //11-1 ,    /*!< index 10 = mux 1, ch 2 */
-    //12-1 ,    /*!< index 11 = mux 1, ch 3 */
-    //13-1 ,    /*!< index 12 = mux 1, ch 4 */
-    //14-1 ,    /*!< index 13 = mux 1, ch 5 */
-    //15-1 ,    /*!< index 14 = mux 1, ch 6 */
-    //16-1      /*!< index 15 = mux 1, ch 7 */
+/**
+ * GPIO of each multiplexer output (0: GPIO1, 1: GPIO2, 2: GPIO3), multiplexers on the same GPIO
+ * are measured one after the other. Set with LTC_MUX0_GPIO to LTC_MUX3_GPIO in ltc_cfg.h, which
+ * checks that only GPIO1 to GPIO3 are used.
+ */
+const uint8_t ltc_mux_gpio_cfg[LTC_N_MUX_PER_LTC] = {
+    LTC_MUX0_GPIO,
+    LTC_MUX1_GPIO,
+    LTC_MUX2_GPIO,
+    LTC_MUX3_GPIO,
+};
+
+
+/**
+ * One entry per temperature sensor of a module (BS_NR_OF_TEMP_SENSORS_PER_MODULE),
+ * the channels must be part of the multiplexer sequence
+ */
+const LTC_TEMPSENSOR_CFG_s ltc_tempsensor_cfg[BS_NR_OF_TEMP_SENSORS_PER_MODULE] = {
+    { .muxID = 0, .muxCh = 0, .type = LTC_NTC_10K_B3435 },     /*!< sensor 0 */
+    { .muxID = 0, .muxCh = 1, .type = LTC_NTC_10K_B3435 },     /*!< sensor 1 */
+    { .muxID = 0, .muxCh = 2, .type = LTC_NTC_10K_B3435 },     /*!< sensor 2 */
+    { .muxID = 0, .muxCh = 3, .type = LTC_NTC_10K_B3435 },     /*!< sensor 3 */
+    { .muxID = 0, .muxCh = 4, .type = LTC_NTC_10K_B3435 },     /*!< sensor 4 */
+    //{ .muxID = 0, .muxCh = 5, .type = LTC_NTC_10K_B3435 },   /*!< sensor 5 */
+    //{ .muxID = 0, .muxCh = 6, .type = LTC_NTC_10K_B3435 },   /*!< sensor 6 */
+    //{ .muxID = 0, .muxCh = 7, .type = LTC_NTC_10K_B3435 },   /*!< sensor 7 */
+    //{ .muxID = 1, .muxCh = 0, .type = LTC_NTC_10K_B3435 },   /*!< sensor 8 */
+    //{ .muxID = 1, .muxCh = 1, .type = LTC_NTC_10K_B3435 },   /*!< sensor 9 */
 };
 
 /*================== Function Prototypes ==================================*/
@@ -38,6 +38,7 @@
 #include "batterysystem_cfg.h"
 #include "spi.h"
 #include "general.h"
+#include "ltc_ntc_cfg.h"
 
 
 
@@ -50,6 +51,27 @@
  */
 #define SLAVE_BOARD_VERSION 2
 
+/**
+ * LTC devices supported by the driver
+ */
+#define LTC_DEVICE_LTC6804      0
+#define LTC_DEVICE_LTC6811      1
+#define LTC_DEVICE_LTC6813      2
+
+/*fox
+ * Type of the LTC devices in the daisy-chain.
+ * LTC6804 and LTC6811: 12 cells, cell voltage register groups A-D
+ * LTC6813: 18 cells, cell voltage register groups A-F. The balancing of cells 13-18
+ * (configuration register group B) is not supported by the driver.
+ * @var      LTC device
+ * @type     select(3)
+ * @default  0
+ * @group    LTC
+ */
+#define LTC_DEVICE LTC_DEVICE_LTC6804
+//#define LTC_DEVICE LTC_DEVICE_LTC6811
+//#define LTC_DEVICE LTC_DEVICE_LTC6813
+
 
 /*fox
  * If set to TRUE, PEC errors do not lead to an error state
@@ -75,6 +97,132 @@
 #define LTC_DISCARD_MUX_CHECK TRUE
 //#define LTC_DISCARD_MUX_CHECK FALSE
 
+/*fox
+ * If set to TRUE, the LTC driver communicates with a simulated daisy-chain (ltc_sim.c)
+ * instead of the SPI interface. Used to benchmark the driver without hardware.
+ * If set to FALSE, the SPI interface is used
+ * @var      Simulate daisy-chain
+ * @type     select(2)
+ * @default  0
+ * @level    debug
+ * @group    LTC
+ */
+//#define LTC_SIMULATION TRUE
+#define LTC_SIMULATION FALSE
+
+/*fox
+ * If set to TRUE, cell voltage and multiplexer measurements are made by the pipelined
+ * measurement state: the multiplexer is switched while the cell voltages are converted and
+ * the cell voltage registers are read while the multiplexer channel is converted.
+ * If set to FALSE, the measurements are made one after another
+ * @var      Pipelined measurement
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_PIPELINED_MEASUREMENT TRUE
+#define LTC_PIPELINED_MEASUREMENT FALSE
+
+/*fox
+ * If set to TRUE, the WRCOMM frames for all multiplexer channels are built with their PEC
+ * at initialization and sent without recalculation during the multiplexer measurement.
+ * Needs LTC_N_MUX_PER_LTC*(LTC_N_MUX_CHANNELS_PER_MUX+1)*LTC_N_BYTES_FOR_DATA_TRANSMISSION bytes of RAM.
+ * If set to FALSE, the frames are built each time a multiplexer channel is set
+ * @var      Multiplexer frame cache
+ * @type     select(2)
+ * @default  1
+ * @level    advanced
+ * @group    LTC
+ */
+#define LTC_MUX_FRAME_CACHE TRUE
+//#define LTC_MUX_FRAME_CACHE FALSE
+
+/*fox
+ * If set to TRUE, the cell voltages and the multiplexer output on GPIO1 are converted
+ * together with one command (ADCVAX) in the pipelined measurement, the separate GPIO
+ * conversion (ADAX) of the multiplexer measurement is not needed anymore. The multiplexer
+ * is switched before the conversion and the GPIO measurement uses the mode of the cell voltage
+ * measurement (LTC_VOLTAGE_MEASUREMENT_MODE).
+ * As the cell conversion waits for the multiplexer setup, this shortens the cycle of short
+ * daisy-chains, for long daisy-chains the overlap of multiplexer setup and ADCV is faster.
+ * Only available for LTC6811 and LTC6813 and with LTC_PIPELINED_MEASUREMENT set to TRUE.
+ * @var      Combined cell and GPIO conversion
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_COMBINED_CONVERSION TRUE
+#define LTC_COMBINED_CONVERSION FALSE
+
+#if (LTC_COMBINED_CONVERSION == TRUE) && ((LTC_DEVICE == LTC_DEVICE_LTC6804) || (LTC_PIPELINED_MEASUREMENT == FALSE))
+#error "LTC_COMBINED_CONVERSION needs an LTC6811 or LTC6813 and LTC_PIPELINED_MEASUREMENT"
+#endif
+
+/*fox
+ * If set to TRUE, the order of the multiplexer measurements is chosen by ltc_muxsched.c:
+ * channels whose temperature changes quickly or is close to a limit are measured several times
+ * per round, stable channels can be left out of a round. A round has as many measurements as
+ * the configured sequence ltc_mux_seq.
+ * If set to FALSE, ltc_mux_seq is measured as configured
+ * @var      Adaptive multiplexer scheduling
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_MUX_ADAPTIVE_SCHEDULING TRUE
+#define LTC_MUX_ADAPTIVE_SCHEDULING FALSE
+
+/**
+ * Maximum number of consecutive rounds a multiplexer channel is left out by the adaptive scheduling.
+ * The data of a channel is at most LTC_MUX_SCHED_MAX_SKIP+1 rounds old.
+ */
+#define LTC_MUX_SCHED_MAX_SKIP          3
+
+/**
+ * Number of times a fast changing channel or a channel close to a limit is measured per round
+ */
+#define LTC_MUX_SCHED_HOT_PASSES        2
+
+/**
+ * Temperature change above which a channel is measured more often, unit: 0.1 degree Celsius per second
+ */
+#define LTC_MUX_SCHED_HOT_RATE          5
+
+/**
+ * Distance to BC_TEMPMAX/BC_TEMPMIN below which a channel is measured more often, unit: 0.1 degree Celsius
+ */
+#define LTC_MUX_SCHED_LIMIT_MARGIN      50
+
+/*fox
+ * If set to TRUE, consecutive steps of the multiplexer sequence whose multiplexers are connected
+ * to different GPIOs (see ltc_mux_gpio_cfg) are measured together: the channels are set one after
+ * the other (one I2C write per WRCOMM), then one GPIO conversion and one read of the auxiliary
+ * register group A give the results of all multiplexers of the group.
+ * If set to FALSE, all multiplexers are measured on GPIO1, one step of the sequence per conversion.
+ * @var      Multi-GPIO multiplexer measurement
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_MUX_MULTI_GPIO TRUE
+#define LTC_MUX_MULTI_GPIO FALSE
+
+/**
+ * The configuration registers are only written by the balance control if the balancing of one of
+ * the LTCs of a daisy-chain changed. They are read back (RDCFG) after each write and every
+ * LTC_BALANCING_VERIFY_PERIOD balance controls without write.
+ */
+#define LTC_BALANCING_VERIFY_PERIOD     5
+
+/**
+ * Maximum number of phases recorded in the timeline of a pipelined measurement
+ */
+#define LTC_PIPELINE_TIMELINE_LENGTH    32
+
 /**
  * Number of used LTC-ICs
  */
@@ -95,11 +243,47 @@
  */
 #define LTC_N_MUX_CHANNELS_PER_LTC      (LTC_N_MUX_PER_LTC*LTC_N_MUX_CHANNELS_PER_MUX)
 
+/**
+ * GPIO the output of each multiplexer is connected to (0: GPIO1, 1: GPIO2, 2: GPIO3), used for
+ * ltc_mux_gpio_cfg. Only GPIO1 to GPIO3 can be used: the results are read from the auxiliary register
+ * group A, GPIO4 and GPIO5 are used for the I2C bus. One define per multiplexer (LTC_N_MUX_PER_LTC).
+ * Must be adapted to the slave board
+ */
+#define LTC_MUX0_GPIO                   0
+#define LTC_MUX1_GPIO                   1
+#define LTC_MUX2_GPIO                   2
+#define LTC_MUX3_GPIO                   2
+
+#if (LTC_MUX0_GPIO > 2) || (LTC_MUX1_GPIO > 2) || (LTC_MUX2_GPIO > 2) || (LTC_MUX3_GPIO > 2)
+#error "LTC_MUXn_GPIO must be 0 to 2 (GPIO1 to GPIO3), only the auxiliary register group A is read"
+#endif
+#if LTC_N_MUX_PER_LTC != 4
+#error "one LTC_MUXn_GPIO per multiplexer is needed, adapt the defines and ltc_mux_gpio_cfg to LTC_N_MUX_PER_LTC"
+#endif
+
 /**
  * Number of LTC-ICs per battery module
  */
 #define LTC_NUMBER_OF_LTC_PER_MODULE    1
 
+/**
+ * Number of cells measured by an LTC-IC
+ */
+#if LTC_DEVICE == LTC_DEVICE_LTC6813
+#define LTC_N_CELLS_PER_LTC             18
+#else
+#define LTC_N_CELLS_PER_LTC             12
+#endif
+
+/**
+ * Number of cell voltage register groups (3 cells each) per LTC-IC
+ */
+#define LTC_N_VOLTAGE_REGISTER_GROUPS   (LTC_N_CELLS_PER_LTC/3)
+
+#if BS_NR_OF_BAT_CELLS_PER_MODULE > (LTC_NUMBER_OF_LTC_PER_MODULE*LTC_N_CELLS_PER_LTC)
+#error "BS_NR_OF_BAT_CELLS_PER_MODULE is higher than the number of cells measured by the LTCs of a module"
+#endif
+
 /**
  * Measurement modus for voltages
  */
@@ -114,6 +298,68 @@
 // #define LTC_GPIO_MEASUREMENT_MODE LTC_ADCMODE_FILTERED_DCP0
 // #define LTC_GPIO_MEASUREMENT_MODE LTC_ADCMODE_FAST_DCP0
 
+/*fox
+ * If set to TRUE, the cell voltages are captured with LTC_BURST_MEASUREMENT_MODE into a ring buffer
+ * for LTC_BURST_WINDOW ms when a capture is requested in DATA_BLOCK_ID_BURSTREQUEST or when the
+ * current changes by more than LTC_BURST_CURRENT_STEP. During the capture only the cell voltages are
+ * measured, the normal measurement cycle (multiplexers, balancing) resumes afterwards.
+ * The captured samples are stored in DATA_BLOCK_ID_BURSTCAPTURE. Needs DATA_SEQLOCK_ACCESS.
+ * @var      Cell voltage burst capture
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_BURST_CAPTURE TRUE
+#define LTC_BURST_CAPTURE FALSE
+
+/**
+ * Measurement modus for the voltages of a burst capture
+ */
+#define LTC_BURST_MEASUREMENT_MODE  LTC_ADCMODE_FAST_DCP0
+
+/**
+ * Duration of a burst capture in ms
+ */
+#define LTC_BURST_WINDOW            100
+
+/**
+ * Number of samples in the burst capture ring buffer (each of BS_NR_OF_BAT_CELLS voltages),
+ * must be equal to DATA_NR_OF_BURST_SAMPLES. If a capture has more samples, the oldest ones are overwritten.
+ */
+#define LTC_BURST_SAMPLES           32
+
+/**
+ * Change of the current between two samples of DATA_BLOCK_ID_CURRENT that starts a burst
+ * capture, unit: mA. 0 disables the current trigger.
+ */
+#define LTC_BURST_CURRENT_STEP      20000
+
+/**
+ * Minimum time between the end of a burst capture and the next current triggered capture in ms,
+ * so that the normal measurement cycle is not starved by a fluctuating current
+ */
+#define LTC_BURST_HOLDOFF           1000
+
+/*fox
+ * If set to TRUE, the current of DATA_BLOCK_ID_CURRENT is interpolated to the conversion of each
+ * cell voltage and the pairs are stored in DATA_BLOCK_ID_CELLVOLTAGE_CURRENT (see ltc_sync.c).
+ * Needs DATA_SEQLOCK_ACCESS.
+ * @var      Synchronized cell voltage and current
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_VOLTAGE_CURRENT_SYNC TRUE
+#define LTC_VOLTAGE_CURRENT_SYNC FALSE
+
+/**
+ * Maximum time between the two current samples used for the interpolation in ms,
+ * the current of a cell conversion between samples further apart is marked as invalid
+ */
+#define LTC_SYNC_MAX_CURRENT_INTERVAL   50
+
 /**
  * SPI1 is used for communication with LTC
  */
@@ -123,6 +369,55 @@
 
 #define LTC_SPI_PRESCALER   *LTC_SPI_HANDLE.Init.BaudRatePrescaler
 
+/*fox
+ * If set to TRUE, the SPI clock of the daisy-chain is adapted to its PEC error rate (see ltc_spiclk.c),
+ * starting from the prescaler configured in spi_devices[]. The clock is slowed down by one prescaler
+ * step when at least LTC_SPICLK_ERRORS_SLOWER of LTC_SPICLK_WINDOW frames had a PEC error, and sped
+ * up by one step after LTC_SPICLK_CLEAN_WINDOWS windows without PEC error, within LTC_SPICLK_MIN_FREQ
+ * and LTC_SPICLK_MAX_FREQ. The transfer times are recomputed after each change.
+ * @var      Adaptive SPI clock
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_ADAPTIVE_SPI_CLOCK TRUE
+#define LTC_ADAPTIVE_SPI_CLOCK FALSE
+
+/**
+ * Highest SPI clock used by the adaptation in Hz (isoSPI: max. 1MHz)
+ */
+#define LTC_SPICLK_MAX_FREQ         1000000
+
+/**
+ * Lowest SPI clock used by the adaptation in Hz
+ */
+#define LTC_SPICLK_MIN_FREQ         100000
+
+/**
+ * Number of PEC checked frames evaluated together
+ */
+#define LTC_SPICLK_WINDOW           100
+
+/**
+ * Number of frames with PEC error in a window that slow down the SPI clock by one step
+ */
+#define LTC_SPICLK_ERRORS_SLOWER    2
+
+/**
+ * Number of consecutive windows without PEC error before the SPI clock is sped up by one step.
+ * Each time the faster clock fails in its first window, the number is doubled, up to
+ * LTC_SPICLK_CLEAN_WINDOWS*LTC_SPICLK_MAX_BACKOFF.
+ */
+#define LTC_SPICLK_CLEAN_WINDOWS    10
+
+/**
+ * Maximum factor (no unit, power of 2) by which LTC_SPICLK_CLEAN_WINDOWS is multiplied after failed
+ * speed-ups, i.e. at most LTC_SPICLK_CLEAN_WINDOWS*LTC_SPICLK_MAX_BACKOFF windows of LTC_SPICLK_WINDOW
+ * frames pass between two attempts to speed up the SPI clock
+ */
+#define LTC_SPICLK_MAX_BACKOFF      64
+
 /**
  * start definition of LTC timings
  * Twake (see LTC datasheet)
@@ -138,6 +433,11 @@
  * Tidle (see LTC datasheet)
  */
 #define LTC_TIDLE_US    6700
+/**
+ * start definition of LTC timings
+ * Tsleep, watchdog timeout of the LTC core (see LTC datasheet)
+ */
+#define LTC_TSLEEP_US   1800000
 
 /**
  * LTC statemachine short time definition in ms
@@ -155,11 +455,123 @@
  */
 #define LTC_STATEMACH_DAISY_CHAIN_SECOND_INITIALIZATION_TIME    ((LTC_TREADY_US*LTC_N_LTC)/1000)
 
+/*fox
+ * If set to TRUE, the time since the last frame of the daisy-chain is tracked (see ltc_keepalive.c).
+ * A dummy byte is sent before the isoSPI ports become idle, a frame to an idle daisy-chain is
+ * preceded by a wake-up frame and the wake-up sequence of the initialization is skipped if the
+ * daisy-chain is awake. If no valid command was sent for LTC_TSLEEP_US (dummy bytes do not count),
+ * the daisy-chain is initialized again.
+ * @var      isoSPI keep-alive
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_KEEPALIVE TRUE
+#define LTC_KEEPALIVE FALSE
+
+/**
+ * Margin in us for the delay between the check of the idle time and the start of the next frame.
+ * The daisy-chain is only considered awake if the transfer of its last frame ended less than
+ * LTC_TIDLE_US-LTC_KEEPALIVE_MARGIN_US ago.
+ */
+#define LTC_KEEPALIVE_MARGIN_US     1000
+
+/*fox
+ * If set to TRUE, the PEC errors, retries and multiplexer NACKs of each LTC are counted (see ltc_health.c)
+ * and stored in DATA_BLOCK_ID_LTC_COMMHEALTH.
+ * @var      communication health statistics
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_COMM_HEALTH TRUE
+#define LTC_COMM_HEALTH FALSE
+
+/**
+ * Frames per bucket of the rolling PEC error window of an LTC. The error rate is updated each time a bucket is full.
+ */
+#define LTC_HEALTH_BUCKET_FRAMES    100
+
+/**
+ * Buckets of the rolling PEC error window, the window spans LTC_HEALTH_BUCKET_FRAMES*LTC_HEALTH_NR_OF_BUCKETS frames
+ */
+#define LTC_HEALTH_NR_OF_BUCKETS    10
+
+/**
+ * Frames of the rolling PEC error window of an LTC
+ */
+#define LTC_HEALTH_WINDOW           (LTC_HEALTH_BUCKET_FRAMES*LTC_HEALTH_NR_OF_BUCKETS)
+
+/**
+ * Period in ms of the update of DATA_BLOCK_ID_LTC_COMMHEALTH
+ */
+#define LTC_HEALTH_PERIOD_MS        1000
+
+/*fox
+ * If set to TRUE, the state and substate transitions of LTC_Trigger() are recorded in a trace buffer
+ * and the durations of the measurement cycles and of the states are evaluated (see ltc_timing.c).
+ * The statistics are stored in DATA_BLOCK_ID_LTC_TIMING.
+ * @var      state machine timing instrumentation
+ * @type     select(2)
+ * @default  0
+ * @level    debug
+ * @group    LTC
+ */
+//#define LTC_TIMING_INSTRUMENTATION TRUE
+#define LTC_TIMING_INSTRUMENTATION FALSE
+
+/**
+ * Number of substate visits kept in the trace buffer
+ */
+#define LTC_TIMING_TRACE_LENGTH     64
+
+/**
+ * Width in us of a bin of the cycle time histogram, the last bin counts all longer cycles
+ */
+#define LTC_TIMING_CYCLE_BIN_US     5000
+
+/**
+ * Width in us of a bin of the state duration histograms, the last bin counts all longer durations
+ */
+#define LTC_TIMING_STATE_BIN_US     1000
+
+/**
+ * Period in ms of the update of DATA_BLOCK_ID_LTC_TIMING
+ */
+#define LTC_TIMING_PERIOD_MS        1000
+
+/**
+ * Period in ms of the output of the statistics on the debug UART (LTC_TIMING_Print()), 0 disables the output.
+ * Only effective with BUILD_MODULE_DEBUGPRINTF.
+ */
+#define LTC_TIMING_PRINT_PERIOD_MS  10000
+
+/**
+ * Number of the last substate visits of the trace buffer printed by LTC_TIMING_Print()
+ */
+#define LTC_TIMING_PRINT_TRACE_ENTRIES  8
+
+/**
+ * Period in ms between two lines of the output of LTC_TIMING_Print(). A line has less than 100 bytes,
+ * i.e. less than 9ms at 115200 baud, so the lines do not pile up in the transmit buffer of the UART.
+ */
+#define LTC_TIMING_PRINT_LINE_MS        10
+
 
 /*
  * Timings of Voltage Cell and GPIO measurement for all cells or all GPIO
  */
 
+#if LTC_DEVICE == LTC_DEVICE_LTC6813
+/*
+ * The LTC6813 converts 6 instead of 4 cells per ADC, the times are scaled from the LTC6804 values and rounded up
+ */
+#define LTC_STATEMACH_MEAS_ALL_FAST_TCYCLE          2
+#define LTC_STATEMACH_MEAS_ALL_NORMAL_TCYCLE        4
+#define LTC_STATEMACH_MEAS_ALL_FILTERED_TCYCLE      303
+#else
 /**
  * ~1.1ms Measurement+Calibration Cycle Time When Starting from the REFUP State in Fast Mode
  * unit: ms
@@ -177,6 +589,37 @@
  * unit: ms
  */
 #define LTC_STATEMACH_MEAS_ALL_FILTERED_TCYCLE      202
+#endif
+
+/*
+ * Conversion times of all cells (Measurement+Calibration Cycle Time When Starting from the REFUP State),
+ * used for the conversion time of each cell voltage
+ * unit: us
+ */
+#if LTC_DEVICE == LTC_DEVICE_LTC6813
+#define LTC_MEAS_ALL_FAST_TCYCLE_US         1670
+#define LTC_MEAS_ALL_NORMAL_TCYCLE_US       3503
+#define LTC_MEAS_ALL_FILTERED_TCYCLE_US     301976
+#else
+#define LTC_MEAS_ALL_FAST_TCYCLE_US         1113
+#define LTC_MEAS_ALL_NORMAL_TCYCLE_US       2335
+#define LTC_MEAS_ALL_FILTERED_TCYCLE_US     201317
+#endif
+
+/*
+ * Timings of the combined measurement of all cells and GPIO1/2 (ADCVAX): each ADC converts two GPIOs
+ * in addition to its cells, the times are scaled from the cell measurement and rounded up
+ * unit: ms
+ */
+#if LTC_DEVICE == LTC_DEVICE_LTC6813
+#define LTC_STATEMACH_MEAS_COMBINED_FAST_TCYCLE     3
+#define LTC_STATEMACH_MEAS_COMBINED_NORMAL_TCYCLE   5
+#define LTC_STATEMACH_MEAS_COMBINED_FILTERED_TCYCLE 403
+#else
+#define LTC_STATEMACH_MEAS_COMBINED_FAST_TCYCLE     2
+#define LTC_STATEMACH_MEAS_COMBINED_NORMAL_TCYCLE   4
+#define LTC_STATEMACH_MEAS_COMBINED_FILTERED_TCYCLE 303
+#endif
 
 
 /*
@@ -221,6 +664,29 @@
  */
 #define LTC_TRANSMIT_PECERRLIMIT    3
 
+/*fox
+ * If set to TRUE, a cell voltage register group with PEC errors is only read again if the
+ * daisy-chain has failing LTCs (see LTC_ErrorTable) and only the data of these LTCs is decoded,
+ * the data of the other LTCs is kept.
+ * If set to FALSE, the register group is read again from all LTCs.
+ * @var      Targeted PEC error retry
+ * @type     select(2)
+ * @default  0
+ * @level    advanced
+ * @group    LTC
+ */
+//#define LTC_TARGETED_PEC_RETRY TRUE
+#define LTC_TARGETED_PEC_RETRY FALSE
+
+/**
+ * Maximum age of a cell voltage conversion result (time since the end of the conversion) up to which
+ * a register group with PEC errors is read again. Older results are accepted, the cells of the failing
+ * LTCs stay marked invalid. This limits the latency added to the measurement cycle by PEC errors.
+ * Only used if LTC_TARGETED_PEC_RETRY is TRUE.
+ * unit: ms
+ */
+#define LTC_PEC_RETRY_MAXAGE        20
+
 /**
  * Maximum number of re-tries in case of SPI error during the communication with daisy chain
  * before going into error state
@@ -243,12 +709,66 @@
  */
 #define LTC_N_BYTES_FOR_DATA_TRANSMISSION   (4+(8*LTC_N_LTC))
 
+/**
+ * Position of the 6 data bytes of an LTC (0 to LTC_N_LTC-1) in a frame of LTC_N_BYTES_FOR_DATA_TRANSMISSION bytes
+ */
+#define LTC_DATA_OFFSET(ltc)    (4 + ((ltc)*8))
+
+/**
+ * Slot in which the data for an LTC is written: the data shifted in first ends up in the last LTC of the daisy-chain
+ */
+#define LTC_WRITE_SLOT(ltc)     ((LTC_N_LTC-1) - (ltc))
+
+/*
+ * Parameters of the simulated daisy-chain, only used if LTC_SIMULATION is set to TRUE
+ */
+
+/**
+ * Mean value of the simulated cell voltages in mV
+ */
+#define LTC_SIM_CELLVOLTAGE_MV  3700
+
+/**
+ * Conversion times of the simulated LTCs for all GPIOs or 4 conversions per ADC (12 cells),
+ * the cell conversion times are scaled with the number of conversions per ADC.
+ * Derived from the conversion times of all cells LTC_MEAS_ALL_xxx_TCYCLE_US (LTC_N_CELLS_PER_LTC/3 conversions per ADC)
+ * unit: us
+ */
+#define LTC_SIM_TCYCLE_ALL_FAST_US          ((LTC_MEAS_ALL_FAST_TCYCLE_US*4)/(LTC_N_CELLS_PER_LTC/3))
+#define LTC_SIM_TCYCLE_ALL_NORMAL_US        ((LTC_MEAS_ALL_NORMAL_TCYCLE_US*4)/(LTC_N_CELLS_PER_LTC/3))
+#define LTC_SIM_TCYCLE_ALL_FILTERED_US      ((LTC_MEAS_ALL_FILTERED_TCYCLE_US*4)/(LTC_N_CELLS_PER_LTC/3))
+
+/**
+ * Conversion times of the simulated LTCs for a single GPIO
+ * unit: us
+ */
+#define LTC_SIM_TCYCLE_SINGLE_FAST_US       201
+#define LTC_SIM_TCYCLE_SINGLE_NORMAL_US     405
+#define LTC_SIM_TCYCLE_SINGLE_FILTERED_US   34000
+
+/**
+ * If not 0, a bit error is injected in every n-th register group read from the simulated daisy-chain
+ */
+#define LTC_SIM_PEC_ERROR_INTERVAL  0
+
 //Transmit functions
-#define LTC_SendWakeUp()                SPI_Transmit(LTC_SPI_HANDLE, (uint8_t *) ltc_cmdDummy, 1)
-#define LTC_SendI2CCmd(txbuf)           SPI_Transmit(LTC_SPI_HANDLE, txbuf, 4+9)
-#define LTC_SendData(txbuf)             SPI_Transmit(LTC_SPI_HANDLE, txbuf, LTC_N_BYTES_FOR_DATA_TRANSMISSION)
-#define LTC_SendCmd(command)            SPI_Transmit(LTC_SPI_HANDLE, (uint8_t *) command, 4)
-#define LTC_ReceiveData(txbuf,rxbuf)    SPI_TransmitReceive(LTC_SPI_HANDLE, txbuf, rxbuf, LTC_N_BYTES_FOR_DATA_TRANSMISSION)
+// The frames are queued in the SPI module and transferred by DMA in the background.
+// LTC_TransferFinished() is TRUE once all queued frames are finished,
+// LTC_ReceiveFailed() is TRUE if the DMA transfer of a received frame failed.
+// LTC_IdleTime_us() is the time since the end of the last transferred frame.
+#if LTC_SIMULATION == TRUE
+#define LTC_Transmit(txbuf,size)                    LTC_SIM_Transmit(txbuf, size)
+#define LTC_TransmitReceive(txbuf,rxbuf,frameID)    LTC_SIM_TransmitReceive(txbuf, rxbuf, LTC_N_BYTES_FOR_DATA_TRANSMISSION)
+#define LTC_TransferFinished()                      TRUE
+#define LTC_ReceiveFailed(frameID)                  FALSE
+#define LTC_IdleTime_us()                           LTC_SIM_GetIdleTime_us()
+#else
+#define LTC_Transmit(txbuf,size)                    SPI_QueueTransmit(LTC_SPI_HANDLE, txbuf, size, NULL_PTR)
+#define LTC_TransmitReceive(txbuf,rxbuf,frameID)    SPI_QueueTransmitReceive(LTC_SPI_HANDLE, txbuf, rxbuf, LTC_N_BYTES_FOR_DATA_TRANSMISSION, frameID)
+#define LTC_TransferFinished()                      SPI_IsQueueIdle()
+#define LTC_ReceiveFailed(frameID)                  ((SPI_GetFrameState(frameID) == SPI_FRAME_ERROR) ? TRUE : FALSE)
+#define LTC_IdleTime_us()                           SPI_GetIdleTime_us()
+#endif
 
 
 
@@ -263,17 +783,29 @@ typedef struct {
     LTC_MUX_CH_CFG_s *seqptr;   /*!< pointer to the multiplexer sequence   */
 } LTC_MUX_SEQUENZ_s;
 
+typedef struct {
+    uint8_t muxID;              /*!< multiplexer ID 0 - 3       */
+    uint8_t muxCh;              /*!< multiplexer channel 0 - 7   */
+    LTC_NTC_TYPE_e type;        /*!< NTC type, selects the lookup table in ltc_ntc_cfg.c */
+} LTC_TEMPSENSOR_CFG_s;
+
 /**
  * Definition of the multiplexer measurement sequence
  */
 extern LTC_MUX_SEQUENZ_s ltc_mux_seq;
 
+/**
+ * GPIO the output of each multiplexer is connected to (0: GPIO1, 1: GPIO2, 2: GPIO3, see LTC_MUX0_GPIO),
+ * only used if LTC_MUX_MULTI_GPIO is TRUE
+ */
+extern const uint8_t ltc_mux_gpio_cfg[LTC_N_MUX_PER_LTC];
+
 /**
  * On the foxBMS slave board there are 6 multiplexer inputs dedicated to temperature
  * sensors by default.
- * Lookup table between temperature sensors and battery cells
+ * Multiplexer channel and NTC type of each temperature sensor of a module
  */
-extern const uint8_t ltc_muxsensortemperatur_cfg[6];
+extern const LTC_TEMPSENSOR_CFG_s ltc_tempsensor_cfg[BS_NR_OF_TEMP_SENSORS_PER_MODULE];
 
 /*================== Function Prototypes ==================================*/
 
@@ -0,0 +1,107 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_ntc_cfg.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS_CONF
+ * @prefix  LTC_NTC
+ *
+ * @brief   NTC lookup tables, temperature for the raw value of a GPIO.
+ *
+ * Generated by ltc_ntc_cfg.py, do not edit.
+ *
+ */
+
+/*================== Includes =============================================*/
+#include "general.h"
+#include "ltc_ntc_cfg.h"
+
+/*================== Constant and Variable Definitions ====================*/
+
+const int16_t ltc_ntc_lut[LTC_NTC_NR_OF_TYPES][LTC_NTC_LUT_LENGTH] = {
+    {   /* LTC_NTC_10K_B3435 */
+         15000,  15000,  15000,  15000,  15000,  15000,  15000,  15000,
+         14686,  14068,  13528,  13049,  12619,  12231,  11876,  11550,
+         11248,  10968,  10706,  10461,  10230,  10012,   9805,   9609,
+          9422,   9244,   9073,   8910,   8753,   8603,   8458,   8318,
+          8183,   8052,   7926,   7803,   7685,   7569,   7457,   7348,
+          7242,   7138,   7038,   6939,   6843,   6749,   6657,   6567,
+          6479,   6393,   6308,   6226,   6144,   6064,   5986,   5909,
+          5833,   5759,   5686,   5614,   5543,   5473,   5404,   5336,
+          5269,   5203,   5138,   5074,   5010,   4948,   4886,   4825,
+          4764,   4705,   4646,   4587,   4529,   4472,   4416,   4360,
+          4304,   4249,   4195,   4141,   4087,   4034,   3982,   3929,
+          3878,   3826,   3775,   3725,   3675,   3625,   3575,   3526,
+          3477,   3429,   3380,   3332,   3285,   3237,   3190,   3143,
+          3097,   3050,   3004,   2958,   2912,   2867,   2821,   2776,
+          2731,   2686,   2641,   2597,   2553,   2508,   2464,   2420,
+          2376,   2333,   2289,   2245,   2202,   2158,   2115,   2072,
+          2029,   1986,   1942,   1899,   1856,   1814,   1771,   1728,
+          1685,   1642,   1599,   1556,   1513,   1470,   1427,   1384,
+          1341,   1298,   1255,   1212,   1169,   1125,   1082,   1038,
+           995,    951,    907,    863,    819,    775,    730,    686,
+           641,    596,    551,    506,    460,    415,    369,    322,
+           276,    229,    182,    135,     87,     40,     -9,    -57,
+          -106,   -156,   -205,   -256,   -306,   -357,   -409,   -461,
+          -514,   -567,   -620,   -675,   -730,   -785,   -842,   -899,
+          -957,  -1015,  -1075,  -1135,  -1197,  -1259,  -1323,  -1387,
+         -1453,  -1520,  -1588,  -1658,  -1729,  -1802,  -1877,  -1953,
+         -2032,  -2113,  -2195,  -2281,  -2369,  -2460,  -2554,  -2652,
+         -2754,  -2859,  -2970,  -3086,  -3208,  -3337,  -3474,  -3620,
+         -3777,  -3946,  -4131,  -4335,  -4564,  -4824,  -5000,  -5000,
+         -5000,  -5000,  -5000,  -5000,
+    },
+    {   /* LTC_NTC_10K_B3950 */
+         15000,  15000,  15000,  15000,  15000,  14606,  13792,  13125,
+         12561,  12075,  11649,  11269,  10927,  10617,  10332,  10070,
+          9827,   9601,   9389,   9190,   9002,   8825,   8656,   8496,
+          8343,   8197,   8057,   7922,   7793,   7669,   7549,   7434,
+          7322,   7214,   7109,   7007,   6909,   6813,   6719,   6628,
+          6540,   6453,   6369,   6287,   6206,   6128,   6051,   5975,
+          5901,   5829,   5758,   5688,   5619,   5552,   5486,   5421,
+          5357,   5294,   5232,   5171,   5111,   5052,   4994,   4936,
+          4879,   4823,   4768,   4713,   4659,   4606,   4553,   4501,
+          4450,   4399,   4349,   4299,   4249,   4200,   4152,   4104,
+          4057,   4010,   3963,   3917,   3871,   3825,   3780,   3735,
+          3691,   3647,   3603,   3559,   3516,   3473,   3431,   3388,
+          3346,   3304,   3263,   3221,   3180,   3139,   3098,   3058,
+          3017,   2977,   2937,   2898,   2858,   2818,   2779,   2740,
+          2701,   2662,   2623,   2584,   2546,   2507,   2469,   2431,
+          2392,   2354,   2316,   2278,   2240,   2202,   2165,   2127,
+          2089,   2052,   2014,   1976,   1939,   1901,   1864,   1826,
+          1789,   1751,   1713,   1676,   1638,   1600,   1563,   1525,
+          1487,   1449,   1411,   1373,   1335,   1297,   1259,   1221,
+          1182,   1144,   1105,   1066,   1027,    988,    949,    910,
+           870,    831,    791,    751,    710,    670,    629,    588,
+           547,    506,    464,    422,    380,    337,    294,    251,
+           207,    163,    119,     74,     29,    -16,    -62,   -109,
+          -156,   -203,   -251,   -300,   -349,   -399,   -449,   -500,
+          -552,   -605,   -658,   -713,   -768,   -824,   -881,   -939,
+          -998,  -1058,  -1120,  -1183,  -1247,  -1313,  -1381,  -1450,
+         -1521,  -1594,  -1669,  -1746,  -1826,  -1909,  -1995,  -2083,
+         -2176,  -2273,  -2374,  -2480,  -2591,  -2709,  -2835,  -2969,
+         -3112,  -3268,  -3439,  -3627,  -3838,  -4080,  -4364,  -4710,
+         -5000,  -5000,  -5000,  -5000,
+    },
+};
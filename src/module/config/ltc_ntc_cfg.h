@@ -0,0 +1,70 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_ntc_cfg.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS_CONF
+ * @prefix  LTC_NTC
+ *
+ * @brief   Headers for the NTC lookup tables.
+ *
+ * Generated by ltc_ntc_cfg.py, do not edit.
+ *
+ */
+
+#ifndef LTC_NTC_CFG_H_
+#define LTC_NTC_CFG_H_
+
+/*================== Includes =============================================*/
+#include "general.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * distance between two table entries: 2^LTC_NTC_LUT_SHIFT raw counts (100uV)
+ */
+#define LTC_NTC_LUT_SHIFT       7
+
+/**
+ * number of entries of each table, the first entry is for the raw value 0
+ */
+#define LTC_NTC_LUT_LENGTH      236
+
+/**
+ * NTC sensor types
+ */
+typedef enum {
+    LTC_NTC_10K_B3435 = 0,       /*!< max. error 0.10 degC (-40..125 degC) */
+    LTC_NTC_10K_B3950 = 1,       /*!< max. error 0.14 degC (-40..125 degC) */
+    LTC_NTC_NR_OF_TYPES = 2,
+} LTC_NTC_TYPE_e;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * temperature tables of the NTC sensor types, unit: 0.01 degree Celsius
+ */
+extern const int16_t ltc_ntc_lut[LTC_NTC_NR_OF_TYPES][LTC_NTC_LUT_LENGTH];
+
+#endif /* LTC_NTC_CFG_H_ */
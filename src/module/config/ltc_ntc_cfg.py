@@ -0,0 +1,229 @@
+# @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Generates the NTC lookup tables ltc_ntc_cfg.c and ltc_ntc_cfg.h.
+
+The temperature sensors are NTCs in a voltage divider supplied by VREF2 of the
+LTC (pull-up resistor between VREF2 and the GPIO, NTC between the GPIO and
+ground). For each sensor type, a table of temperatures is generated for raw
+GPIO values (unit 100uV) on a uniform grid with 2^LUT_SHIFT counts between two
+entries, so that the LTC driver only needs a shift and an integer
+interpolation (see ltc_ntc.c).
+
+The characteristic of each type is given with the Steinhart-Hart equation
+1/T = A + B*ln(R) + C*ln(R)^3. For NTCs specified with R25 and a beta value,
+steinhart_hart_from_beta() gives the coefficients (C = 0).
+
+Usage (from this directory, after changing the configuration below):
+    python ltc_ntc_cfg.py
+
+The maximum error of the interpolation with respect to the Steinhart-Hart
+equation is printed and written to the generated files.
+"""
+
+import math
+import os
+
+# supply of the voltage dividers (VREF2 of the LTC6804), unit: V
+VREF = 3.0
+
+# distance between two table entries: 2^LUT_SHIFT raw counts (100uV)
+LUT_SHIFT = 7
+
+# temperatures outside of this range are clamped, unit: degree Celsius
+T_CLAMP_MIN = -50.0
+T_CLAMP_MAX = 150.0
+
+# range in which the interpolation error is evaluated, unit: degree Celsius
+T_EVAL_MIN = -40.0
+T_EVAL_MAX = 125.0
+
+
+LICENSE = [
+    '/**',
+    ' *',
+    ' * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.',
+    ' *',
+    ' * BSD 3-Clause License',
+    ' * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:',
+    ' * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.',
+    ' * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.',
+    ' * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.',
+    ' *',
+    ' * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.',
+    ' *',
+    ' * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:',
+    ' *',
+    ' * &Prime;This product uses parts of foxBMS&reg;&Prime;',
+    ' *',
+    ' * &Prime;This product includes parts of foxBMS&reg;&Prime;',
+    ' *',
+    ' * &Prime;This product is derived from foxBMS&reg;&Prime;',
+    ' *',
+    ' */',
+]
+
+
+def steinhart_hart_from_beta(r25, beta):
+    """Steinhart-Hart coefficients of an NTC given by R25 and beta"""
+    return (1.0/298.15 - math.log(r25)/beta, 1.0/beta, 0.0)
+
+
+# sensor types: name used in the C enum, pull-up resistor (ohm), Steinhart-Hart coefficients
+SENSOR_TYPES = [
+    ('LTC_NTC_10K_B3435', 10000.0, steinhart_hart_from_beta(10000.0, 3435.0)),
+    ('LTC_NTC_10K_B3950', 10000.0, steinhart_hart_from_beta(10000.0, 3950.0)),
+]
+
+
+def temperature(raw, pullup, sh):
+    """temperature in degree Celsius for a raw GPIO value, Steinhart-Hart reference"""
+    v = raw*100e-6
+    if v <= 0.0:
+        return T_CLAMP_MAX
+    if v >= VREF:
+        return T_CLAMP_MIN
+    r = pullup*v/(VREF - v)
+    lnr = math.log(r)
+    t = 1.0/(sh[0] + sh[1]*lnr + sh[2]*lnr**3) - 273.15
+    return min(max(t, T_CLAMP_MIN), T_CLAMP_MAX)
+
+
+def raw_value(t, pullup, sh):
+    """raw GPIO value for a temperature (bisection, the characteristic is monotonic)"""
+    lo, hi = 0, int(VREF/100e-6)
+    while hi - lo > 1:
+        mid = (lo + hi)//2
+        if temperature(mid, pullup, sh) > t:
+            lo = mid
+        else:
+            hi = mid
+    return hi
+
+
+def interpolate(table, raw):
+    """same integer interpolation as LTC_NTC_Convert(), result in 0.1 degree Celsius"""
+    idx = raw >> LUT_SHIFT
+    if idx >= len(table) - 1:
+        t = table[-1]
+    else:
+        frac = raw & ((1 << LUT_SHIFT) - 1)
+        t = table[idx] - (((table[idx] - table[idx+1])*frac) >> LUT_SHIFT)
+    return (t + 5)//10 if t >= 0 else -((-t + 5)//10)
+
+
+def generate():
+    nr_of_entries = (int(VREF/100e-6) >> LUT_SHIFT) + 2
+    tables = []
+    for name, pullup, sh in SENSOR_TYPES:
+        table = [int(round(100.0*temperature(i << LUT_SHIFT, pullup, sh))) for i in range(nr_of_entries)]
+        # LTC_NTC_Convert() relies on falling tables
+        assert all(table[i] >= table[i+1] for i in range(nr_of_entries - 1))
+        raw_lo = raw_value(T_EVAL_MAX, pullup, sh)
+        raw_hi = raw_value(T_EVAL_MIN, pullup, sh)
+        err = max(abs(interpolate(table, raw)/10.0 - temperature(raw, pullup, sh)) for raw in range(raw_lo, raw_hi + 1))
+        tables.append((name, table, err))
+        print('%s: max. error %.3f degC (%.0f..%.0f degC)' % (name, err, T_EVAL_MIN, T_EVAL_MAX))
+
+    def banner(filename, brief):
+        return LICENSE + [
+            '',
+            '/**',
+            ' * @file    %s' % filename,
+            ' * @author  foxBMS Team',
+            ' * @date    17.10.2026 (date of creation)',
+            ' * @ingroup DRIVERS_CONF',
+            ' * @prefix  LTC_NTC',
+            ' *',
+            ' * @brief   %s' % brief,
+            ' *',
+            ' * Generated by ltc_ntc_cfg.py, do not edit.',
+            ' *',
+            ' */',
+            '',
+        ]
+
+    h = banner('ltc_ntc_cfg.h', 'Headers for the NTC lookup tables.') + [
+        '#ifndef LTC_NTC_CFG_H_',
+        '#define LTC_NTC_CFG_H_',
+        '',
+        '/*================== Includes =============================================*/',
+        '#include "general.h"',
+        '',
+        '/*================== Macros and Definitions ===============================*/',
+        '',
+        '/**',
+        ' * distance between two table entries: 2^LTC_NTC_LUT_SHIFT raw counts (100uV)',
+        ' */',
+        '#define LTC_NTC_LUT_SHIFT       %d' % LUT_SHIFT,
+        '',
+        '/**',
+        ' * number of entries of each table, the first entry is for the raw value 0',
+        ' */',
+        '#define LTC_NTC_LUT_LENGTH      %d' % nr_of_entries,
+        '',
+        '/**',
+        ' * NTC sensor types',
+        ' */',
+        'typedef enum {',
+    ]
+    for i, (name, table, err) in enumerate(tables):
+        h.append('    %s = %d,%s/*!< max. error %.2f degC (%.0f..%.0f degC) */' % (name, i, ' '*(24 - len(name)), err, T_EVAL_MIN, T_EVAL_MAX))
+    h += [
+        '    LTC_NTC_NR_OF_TYPES = %d,' % len(tables),
+        '} LTC_NTC_TYPE_e;',
+        '',
+        '/*================== Constant and Variable Definitions ====================*/',
+        '',
+        '/**',
+        ' * temperature tables of the NTC sensor types, unit: 0.01 degree Celsius',
+        ' */',
+        'extern const int16_t ltc_ntc_lut[LTC_NTC_NR_OF_TYPES][LTC_NTC_LUT_LENGTH];',
+        '',
+        '#endif /* LTC_NTC_CFG_H_ */',
+        '',
+    ]
+
+    c = banner('ltc_ntc_cfg.c', 'NTC lookup tables, temperature for the raw value of a GPIO.') + [
+        '/*================== Includes =============================================*/',
+        '#include "general.h"',
+        '#include "ltc_ntc_cfg.h"',
+        '',
+        '/*================== Constant and Variable Definitions ====================*/',
+        '',
+        'const int16_t ltc_ntc_lut[LTC_NTC_NR_OF_TYPES][LTC_NTC_LUT_LENGTH] = {',
+    ]
+    for name, table, err in tables:
+        c.append('    {   /* %s */' % name)
+        for i in range(0, len(table), 8):
+            c.append('        ' + ' '.join('%6d,' % v for v in table[i:i+8]))
+        c.append('    },')
+    c += [
+        '};',
+        '',
+    ]
+
+    path = os.path.dirname(os.path.abspath(__file__))
+    with open(os.path.join(path, 'ltc_ntc_cfg.h'), 'w') as f:
+        f.write('\n'.join(h))
+    with open(os.path.join(path, 'ltc_ntc_cfg.c'), 'w') as f:
+        f.write('\n'.join(c))
+
+
+if __name__ == '__main__':
+    generate()
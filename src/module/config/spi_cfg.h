@@ -48,6 +48,13 @@
 #define SPI_NSS_PORT1   IO_PIN_MCU_1_BMS_INTERFACE_SPI_NSS
 #define SPI_NSS_PORT2   IO_PIN_MCU_1_TO_MCU_0_INTERFACE_SPI_NSS
 
+/**
+ * Number of frames that can be queued for asynchronous DMA transfer with
+ * SPI_QueueTransmit()/SPI_QueueTransmitReceive().
+ * Must be a power of two and <= 128 (frame IDs are 8 bit sequence numbers).
+ */
+#define SPI_QUEUE_LENGTH    8
+
 
 /*================== Constant and Variable Definitions ====================*/
 extern SPI_HandleTypeDef spi_devices[];
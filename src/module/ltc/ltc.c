@@ -48,6 +48,15 @@
 #include "diag.h"
 #include "os.h"
 #include "ltc_pec.h"
+#include "ltc_sim.h"
+#include "ltc_muxsched.h"
+#include "ltc_ntc.h"
+#include "ltc_burst.h"
+#include "ltc_sync.h"
+#include "ltc_spiclk.h"
+#include "ltc_keepalive.h"
+#include "ltc_health.h"
+#include "ltc_timing.h"
 
 /*================== Macros and Definitions ===============================*/
 // LTC COMM definitions
@@ -66,6 +75,20 @@
 #define LTC_SAVELASTSTATES()    ltc_state.laststate=ltc_state.state; \
                                 ltc_state.lastsubstate = ltc_state.substate
 
+/**
+ * Substate reading the last cell voltage register group (D, F for the LTC6813)
+ */
+#if LTC_N_VOLTAGE_REGISTER_GROUPS > 4
+#define LTC_READ_VOLTAGE_REGISTER_LAST_READVOLTAGE  LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE
+#else
+#define LTC_READ_VOLTAGE_REGISTER_LAST_READVOLTAGE  LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE
+#endif
+
+/**
+ * first value of ltc_taskcycle of the burst capture, after the steps of the normal measurement cycle
+ */
+#define LTC_BURST_TASKCYCLE     20
+
 /*================== Constant and Variable Definitions ====================*/
 static uint32_t ltc_task_1ms_cnt = 0;
 static uint8_t ltc_taskcycle = 0;
@@ -74,11 +97,20 @@ static STD_RETURN_TYPE_e ltc_muxcycle_finished = E_NOT_OK;
 static DATA_BLOCK_CELLVOLTAGE_s ltc_cellvoltage;
 static DATA_BLOCK_CELLTEMPERATURE_s ltc_celltemperature;
 static DATA_BLOCK_MINMAX_s ltc_minmax;
+static uint16_t ltc_voltage_min = 0xFFFF;       // running minimum of the voltage registers decoded since register group A
+static uint16_t ltc_voltage_max = 0;            // running maximum of the voltage registers decoded since register group A
+static uint16_t ltc_voltage_min_index = 0;      // cell index of ltc_voltage_min in ltc_cellvoltage.voltage[]
+static uint16_t ltc_voltage_max_index = 0;      // cell index of ltc_voltage_max in ltc_cellvoltage.voltage[]
+static uint8_t ltc_voltage_retry = FALSE;       // TRUE while a register group is read again from the LTCs flagged in LTC_ErrorTable
 static DATA_BLOCK_BALANCING_FEEDBACK_s ltc_balancing_feedback;
 static DATA_BLOCK_BALANCING_CONTROL_s ltc_balancing_control;
 
 
 static LTC_ERRORTABLE_s LTC_ErrorTable[BS_NR_OF_MODULES]; // init in LTC_ResetErrorTable-function
+static uint32_t ltc_pec_failmap[LTC_PEC_FAILMAP_WORDS(LTC_N_LTC)]; // LTCs with wrong PEC in the last received frame
+
+static LTC_PIPELINE_s ltc_pipeline;                     // state of the running pipelined measurement
+static LTC_PIPELINE_TIMELINE_s ltc_pipeline_timeline;   // timeline of the last finished pipelined measurement
 
 
 static LTC_STATE_s ltc_state = {
@@ -100,48 +132,75 @@ static LTC_STATE_s ltc_state = {
     .muxSampleTime          = 0,
     .commandDataTransferTime= 3,
     .commandTransferTime    = 3,
+    .commandTransferTime_us = 3000,
     .gpioClocksTransferTime = 3,
     .muxmeas_seqptr         = NULL_PTR,
     .muxmeas_seqendptr      = NULL_PTR,
     .muxmeas_nr_end         = 0,
+    .muxmeas_groupptr       = NULL_PTR,
+    .muxmeas_groupendptr    = NULL_PTR,
+    .muxmeas_gpiomask       = 0,
 };
 
 static const uint8_t ltc_cmdDummy[1]={0x00};
-static const uint8_t ltc_cmdRefOn[4]={0x00,0x01,0x3D,0x6E};
-
-static const uint8_t ltc_cmdRDCVA[4] = {0x00,0x04,0x07,0xC2};
-static const uint8_t ltc_cmdRDCVB[4] = {0x00,0x06,0x9A,0x94};
-static const uint8_t ltc_cmdRDCVC[4] = {0x00,0x08,0x5E,0x52};
-static const uint8_t ltc_cmdRDCVD[4] = {0x00,0x0A,0xC3,0x04};
-static const uint8_t ltc_cmdWRCOMM[4] = {0x07,0x21,0x24,0xB2};
-static const uint8_t ltc_cmdSTCOMM[4] = {0x07,0x23,0xB9,0xE4};
-static const uint8_t ltc_cmdRDCOMM[4] = {0x07,0x22,0x32,0xD6};
-static const uint8_t ltc_cmdRDAUXA[4] = {0x00,0x0C,0xEF,0xCC};
-static const uint8_t ltc_cmdRDAUXB[4] = {0x00,0x0E,0x72,0x9A};
+static const uint8_t ltc_cmdRefOn[4] = {LTC_CMD_WITH_PEC(0x0001)};
+static const uint8_t ltc_cmdRDCFG[4] = {LTC_CMD_WITH_PEC(0x0002)};
+
+static const uint8_t ltc_cmdRDCVA[4] = {LTC_CMD_WITH_PEC(0x0004)};
+static const uint8_t ltc_cmdRDCVB[4] = {LTC_CMD_WITH_PEC(0x0006)};
+static const uint8_t ltc_cmdRDCVC[4] = {LTC_CMD_WITH_PEC(0x0008)};
+static const uint8_t ltc_cmdRDCVD[4] = {LTC_CMD_WITH_PEC(0x000A)};
+#if LTC_N_VOLTAGE_REGISTER_GROUPS > 4
+static const uint8_t ltc_cmdRDCVE[4] = {LTC_CMD_WITH_PEC(0x0009)};
+static const uint8_t ltc_cmdRDCVF[4] = {LTC_CMD_WITH_PEC(0x000B)};
+#endif
+static const uint8_t ltc_cmdWRCOMM[4] = {LTC_CMD_WITH_PEC(0x0721)};
+static const uint8_t ltc_cmdRDCOMM[4] = {LTC_CMD_WITH_PEC(0x0722)};
+static const uint8_t ltc_cmdRDAUXA[4] = {LTC_CMD_WITH_PEC(0x000C)};
+static const uint8_t ltc_cmdRDAUXB[4] = {LTC_CMD_WITH_PEC(0x000E)};
+
+/* STCOMM followed by 72 clock cycles for the I2C communication */
+static const uint8_t ltc_frameSTCOMM[4+9] = {LTC_CMD_WITH_PEC(0x0723), 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
 /* Cells */
-static const uint8_t ltc_cmdADCV_normal_DCP0[4] = {0x03,0x60,0xF4,0x6C};   /*!< All cells, normal mode, discharge not permitted (DCP=0)    */
-static const uint8_t ltc_cmdADCV_normal_DCP1[4] = {0x03,0x70,0xAF,0x42};   /*!< All cells, normal mode, discharge permitted (DCP=1)        */
-static const uint8_t ltc_cmdADCV_filtered_DCP0[4] = {0x03,0xE0,0xB0,0x4A}; /*!< All cells, filtered mode, discharge not permitted (DCP=0)  */
-static const uint8_t ltc_cmdADCV_filtered_DCP1[4] = {0x03,0xF0,0xEB,0x64}; /*!< All cells, filtered mode, discharge permitted (DCP=1)      */
-static const uint8_t ltc_cmdADCV_fast_DCP0[4] = {0x02,0xE0,0x38,0x06};     /*!< All cells, fast mode, discharge not permitted (DCP=0)      */
-static const uint8_t ltc_cmdADCV_fast_DCP1[4] = {0x02,0xF0,0x63,0x28};     /*!< All cells, fast mode, discharge permitted (DCP=1)          */
+static const uint8_t ltc_cmdADCV_normal_DCP0[4] = {LTC_CMD_WITH_PEC(0x0360)};   /*!< All cells, normal mode, discharge not permitted (DCP=0)    */
+static const uint8_t ltc_cmdADCV_normal_DCP1[4] = {LTC_CMD_WITH_PEC(0x0370)};   /*!< All cells, normal mode, discharge permitted (DCP=1)        */
+static const uint8_t ltc_cmdADCV_filtered_DCP0[4] = {LTC_CMD_WITH_PEC(0x03E0)}; /*!< All cells, filtered mode, discharge not permitted (DCP=0)  */
+static const uint8_t ltc_cmdADCV_filtered_DCP1[4] = {LTC_CMD_WITH_PEC(0x03F0)}; /*!< All cells, filtered mode, discharge permitted (DCP=1)      */
+static const uint8_t ltc_cmdADCV_fast_DCP0[4] = {LTC_CMD_WITH_PEC(0x02E0)};     /*!< All cells, fast mode, discharge not permitted (DCP=0)      */
+static const uint8_t ltc_cmdADCV_fast_DCP1[4] = {LTC_CMD_WITH_PEC(0x02F0)};     /*!< All cells, fast mode, discharge permitted (DCP=1)          */
+
+#if LTC_COMBINED_CONVERSION == TRUE
+// Cells and GPIO1/2 in one conversion (LTC6811/LTC6813)
+static const uint8_t ltc_cmdADCVAX_normal_DCP0[4] = {LTC_CMD_WITH_PEC(0x056F)};   /*!< All cells and GPIO1/2, normal mode, discharge not permitted (DCP=0)      */
+static const uint8_t ltc_cmdADCVAX_normal_DCP1[4] = {LTC_CMD_WITH_PEC(0x057F)};   /*!< All cells and GPIO1/2, normal mode, discharge permitted (DCP=1)          */
+static const uint8_t ltc_cmdADCVAX_filtered_DCP0[4] = {LTC_CMD_WITH_PEC(0x05EF)}; /*!< All cells and GPIO1/2, filtered mode, discharge not permitted (DCP=0)    */
+static const uint8_t ltc_cmdADCVAX_filtered_DCP1[4] = {LTC_CMD_WITH_PEC(0x05FF)}; /*!< All cells and GPIO1/2, filtered mode, discharge permitted (DCP=1)        */
+static const uint8_t ltc_cmdADCVAX_fast_DCP0[4] = {LTC_CMD_WITH_PEC(0x04EF)};     /*!< All cells and GPIO1/2, fast mode, discharge not permitted (DCP=0)        */
+static const uint8_t ltc_cmdADCVAX_fast_DCP1[4] = {LTC_CMD_WITH_PEC(0x04FF)};     /*!< All cells and GPIO1/2, fast mode, discharge permitted (DCP=1)            */
+#endif
 
 /* GPIOs  */
-static const uint8_t ltc_cmdADAX_normal_GPIO1[4] = {0x05,0x61,0x58,0x92};      /*!< Single channel, GPIO 1, normal mode   */
-static const uint8_t ltc_cmdADAX_filtered_GPIO1[4] = {0x05,0xE1,0x1C,0xB4};    /*!< Single channel, GPIO 1, filtered mode */
-static const uint8_t ltc_cmdADAX_fast_GPIO1[4] = {0x04,0xE1,0x94,0xF8};        /*!< Single channel, GPIO 1, fast mode     */
-static const uint8_t ltc_cmdADAX_normal_ALLGPIOS[4] = {0x05,0x60,0xD3,0xA0};   /*!< All channels, normal mode             */
-static const uint8_t ltc_cmdADAX_filtered_ALLGPIOS[4] = {0x05,0xE0,0x97,0x86}; /*!< All channels, filtered mode           */
-static const uint8_t ltc_cmdADAX_fast_ALLGPIOS[4] = {0x04,0xE0,0x1F,0xCA};     /*!< All channels, fast mode               */
+static const uint8_t ltc_cmdADAX_normal_GPIO1[4] = {LTC_CMD_WITH_PEC(0x0561)};      /*!< Single channel, GPIO 1, normal mode   */
+static const uint8_t ltc_cmdADAX_filtered_GPIO1[4] = {LTC_CMD_WITH_PEC(0x05E1)};    /*!< Single channel, GPIO 1, filtered mode */
+static const uint8_t ltc_cmdADAX_fast_GPIO1[4] = {LTC_CMD_WITH_PEC(0x04E1)};        /*!< Single channel, GPIO 1, fast mode     */
+static const uint8_t ltc_cmdADAX_normal_ALLGPIOS[4] = {LTC_CMD_WITH_PEC(0x0560)};   /*!< All channels, normal mode             */
+static const uint8_t ltc_cmdADAX_filtered_ALLGPIOS[4] = {LTC_CMD_WITH_PEC(0x05E0)}; /*!< All channels, filtered mode           */
+static const uint8_t ltc_cmdADAX_fast_ALLGPIOS[4] = {LTC_CMD_WITH_PEC(0x04E0)};     /*!< All channels, fast mode               */
 
 static uint8_t ltc_tmpTXbuffer[6*LTC_N_LTC];
 
 static uint8_t ltc_DataBufferSPI_TX_with_PEC_init[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
 
+/* shadow of the configuration registers: last WRCFG frame sent to the daisy-chain, with PEC */
+static uint8_t ltc_DataBufferSPI_TX_with_PEC_balancing[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
+static uint8_t ltc_DataBufferSPI_RX_with_PEC_balancing[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
+static uint8_t ltc_balancing_shadow_valid = FALSE;  /* FALSE: the shadow must be rebuilt and sent */
+static uint8_t ltc_balancing_changed = FALSE;       /* TRUE: the shadow must be sent */
+static uint8_t ltc_balancing_verify_counter = 0;
+
 static uint8_t ltc_tmpTXPECbuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
 static uint8_t ltc_DataBufferSPI_RX_with_PEC_voltages[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
-static uint8_t LTC_CellVoltages[LTC_N_LTC*2*12];
 static uint8_t LTC_MultiplexerVoltages[LTC_N_LTC*2*4*8];
 static uint8_t LTC_GPIOVoltages[LTC_N_LTC*2*6];
 
@@ -149,45 +208,72 @@ static uint16_t LTC_allGPIOVoltages[LTC_N_LTC*6];
 
 static uint8_t ltc_DataBufferSPI_TX_temperatures[6*LTC_N_LTC];
 
-static uint8_t ltc_DataBufferSPI_TX_ClockCycles[4+9];
-static uint8_t ltc_DataBufferSPI_TX_ClockCycles_with_PEC[4+9];
+#if LTC_MUX_FRAME_CACHE == TRUE
+/* WRCOMM frames with PEC for each multiplexer and channel, the last channel index is used for 0xFF (multiplexer off) */
+static uint8_t ltc_mux_frame_cache[LTC_N_MUX_PER_LTC][LTC_N_MUX_CHANNELS_PER_MUX+1][LTC_N_BYTES_FOR_DATA_TRANSMISSION];
+#endif
 
 static uint8_t ltc_DataBufferSPI_TX_with_PEC_temperatures[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
 static uint8_t ltc_DataBufferSPI_RX_with_PEC_temperatures[LTC_N_BYTES_FOR_DATA_TRANSMISSION];
 
 /*================== Function Prototypes ==================================*/
-static float LTC_Convert_MuxVoltages_to_Temperatures(float Vout);
-
 static void LTC_Initialize_Database(void);
 static void LTC_SaveVoltages(void);
 static void LTC_SaveTemperatures_SaveBalancingFeedback(void);
 static void LTC_Get_BalancingControlValues(void);
 
-static STD_RETURN_TYPE_e LTC_BalanceControl(void);
+static STD_RETURN_TYPE_e LTC_BalanceControl(uint8_t *written);
+static void LTC_CheckBalancingRegisters(uint8_t *DataBufferSPI_RX_with_PEC);
 
 static void LTC_ResetErrorTable(void) ;
 static STD_RETURN_TYPE_e LTC_Init(void);
 
 static STD_RETURN_TYPE_e LTC_StartVoltageMeasurement(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e  adcMeasCh);
 static STD_RETURN_TYPE_e LTC_StartGPIOMeasurement(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e  adcMeasCh);
+#if LTC_COMBINED_CONVERSION == TRUE
+static STD_RETURN_TYPE_e LTC_StartCombinedMeasurement(LTC_ADCMODE_e adcMode);
+#endif
 static uint16_t LTC_Get_MeasurementTCycle(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHAN_e  adcMeasCh);
 
-static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer);
+static STD_RETURN_TYPE_e LTC_DecodeVoltageRegister(uint8_t registerSet, uint8_t *rxBuffer);
 
 static STD_RETURN_TYPE_e LTC_RX_PECCheck(uint8_t *DataBufferSPI_RX_with_PEC);
 static STD_RETURN_TYPE_e LTC_RX(uint8_t *Command, uint8_t *DataBufferSPI_RX_with_PEC);
+static uint8_t LTC_RetryVoltageRegister(void);
+static STD_RETURN_TYPE_e LTC_SendWakeUp(void);
+static STD_RETURN_TYPE_e LTC_QueueFrame(uint8_t *txbuf, uint16_t size);
+static STD_RETURN_TYPE_e LTC_SendI2CCmd(uint8_t *txbuf);
+static STD_RETURN_TYPE_e LTC_SendData(uint8_t *txbuf);
+static STD_RETURN_TYPE_e LTC_SendCmd(const uint8_t *command);
+static STD_RETURN_TYPE_e LTC_ReceiveData(uint8_t *txbuf, uint8_t *rxbuf);
 static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC);
+static void LTC_BuildTXFrame(uint8_t *Command, uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC);
 static void LTC_SetMUXChCommand(uint8_t *DataBufferSPI_TX, uint8_t mux, uint8_t channel);
 static uint8_t LTC_SetMuxChannel(uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC, uint8_t mux, uint8_t channel);
 
-static STD_RETURN_TYPE_e LTC_I2CClock(uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC);
+#if LTC_MUX_FRAME_CACHE == TRUE
+static void LTC_BuildMuxFrameCache(void);
+#endif
+
+static STD_RETURN_TYPE_e LTC_I2CClock(void);
 
-static uint8_t LTC_I2CCheckACK(uint8_t *DataBufferSPI_RX,int mux);
+static uint8_t LTC_I2CCheckACK(uint8_t *DataBufferSPI_RX, int mux, uint8_t muxCh);
 
-static void LTC_SaveMuxMeasurement(uint8_t *DataBufferSPI_RX, LTC_MUX_CH_CFG_s  *muxseqptr);
+static void LTC_SaveMuxMeasurement(uint8_t *DataBufferSPI_RX, LTC_MUX_CH_CFG_s  *muxseqptr, uint8_t pecValid);
+static void LTC_RestartMuxSequence(void);
+static void LTC_StartMuxGroup(void);
+static LTC_ADCMEAS_CHAN_e LTC_GetMuxGroupMeasCh(void);
 static void LTC_SaveGPIOMeasurement(uint8_t registerSet, uint8_t *rxBuffer);
 static void LTC_SaveAllGPIOs(void);
 
+static void LTC_PipelineInit(void);
+static void LTC_PipelineSchedule(void);
+static void LTC_PipelineNextMuxStep(uint8_t measured);
+static void LTC_PipelineMuxChannelSet(void);
+static void LTC_PipelineTimelineAdd(LTC_PIPELINE_PHASE_e phase, uint32_t start, uint32_t end);
+static void LTC_PipelineTransferError(void);
+static STD_RETURN_TYPE_e LTC_PipelinePECError(uint8_t *accept);
+
 static uint32_t LTC_GetSPIClock(void);
 static void LTC_SetTransferTimes(void);
 
@@ -225,6 +311,10 @@ static void LTC_Initialize_Database(void) {
     for (i=0; i<BS_NR_OF_BAT_CELLS;i++) {
         ltc_cellvoltage.voltage[i] = 0;
     }
+    for (i=0; i<BS_NR_OF_MODULES;i++) {
+        ltc_cellvoltage.sumOfCells[i] = 0;
+        ltc_cellvoltage.valid_voltPECs[i] = 0;
+    }
 
     ltc_celltemperature.state = 0;
     ltc_celltemperature.timestamp = 0;
@@ -275,8 +365,9 @@ static void LTC_SaveAllGPIOs(void) {
 /**
  * @brief   stores the measured voltages in the database.
  *
- * This function loops through the data of all modules in the LTC daisy-chain that are
- * stored in the LTC_CellVoltages buffer and writes them in the database.
+ * The cell voltages, the sums of the modules and the minimum and maximum are already
+ * computed by LTC_DecodeVoltageRegister() while the register groups are received.
+ * This function only computes the mean and writes the results in the database.
  * At each write iteration, the variable named "state" and related to voltages in the
  * database is incremented.
  *
@@ -286,42 +377,10 @@ static void LTC_SaveAllGPIOs(void) {
 static void LTC_SaveVoltages(void) {
 
     uint16_t i = 0;
-    uint16_t j = 0;
-    uint16_t val_ui = 0;
-    float  val_fl = 0.0;
-    uint16_t min = 0;
-    uint16_t max = 0;
     uint32_t mean = 0;
-    uint8_t module_number_min = 0;
-    uint8_t module_number_max = 0;
-    uint8_t cell_number_min = 0;
-    uint8_t cell_number_max = 0;
-
-    for (i=0;i<BS_NR_OF_MODULES;i++) {
-        for (j=0;j<BS_NR_OF_BAT_CELLS_PER_MODULE;j++) {
-
-            val_ui = *((uint16_t *)(&LTC_CellVoltages[2*j+i*LTC_NUMBER_OF_LTC_PER_MODULE*24]));        // raw values
-            val_fl = ((float)(val_ui))*100e-6*1000.0;        // Unit V -> in mV
-            ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j]=(uint16_t)(val_fl);
-        }
-    }
 
-    max = min = ltc_cellvoltage.voltage[0];
-    mean = 0;
     for (i=0;i<BS_NR_OF_MODULES;i++) {
-        for (j=0;j<BS_NR_OF_BAT_CELLS_PER_MODULE;j++) {
-            mean += ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
-            if (ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] < min) {
-                min = ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
-                module_number_min = i;
-                cell_number_min = j;
-            }
-            if (ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j] > max) {
-                max = ltc_cellvoltage.voltage[i*(BS_NR_OF_BAT_CELLS_PER_MODULE)+j];
-                module_number_max = i;
-                cell_number_max = j;
-            }
-        }
+        mean += ltc_cellvoltage.sumOfCells[i];
     }
     mean /= (BS_NR_OF_BAT_CELLS);
 
@@ -329,16 +388,22 @@ static void LTC_SaveVoltages(void) {
     ltc_cellvoltage.state++;
     ltc_minmax.state++;
     ltc_minmax.voltage_mean = mean;
-    ltc_minmax.previous_voltage_min = ltc_minmax.voltage_min;
-    ltc_minmax.voltage_min = min;
-    ltc_minmax.voltage_module_number_min = module_number_min;
-    ltc_minmax.voltage_cell_number_min = cell_number_min;
-    ltc_minmax.previous_voltage_max = ltc_minmax.voltage_max;
-    ltc_minmax.voltage_max = max;
-    ltc_minmax.voltage_module_number_max = module_number_max;
-    ltc_minmax.voltage_cell_number_max = cell_number_max;
+    // no cell decoded since register group A (all PECs wrong): keep last minimum and maximum
+    if (ltc_voltage_min <= ltc_voltage_max) {
+        ltc_minmax.previous_voltage_min = ltc_minmax.voltage_min;
+        ltc_minmax.voltage_min = ltc_voltage_min;
+        ltc_minmax.voltage_module_number_min = ltc_voltage_min_index/BS_NR_OF_BAT_CELLS_PER_MODULE;
+        ltc_minmax.voltage_cell_number_min = ltc_voltage_min_index%BS_NR_OF_BAT_CELLS_PER_MODULE;
+        ltc_minmax.previous_voltage_max = ltc_minmax.voltage_max;
+        ltc_minmax.voltage_max = ltc_voltage_max;
+        ltc_minmax.voltage_module_number_max = ltc_voltage_max_index/BS_NR_OF_BAT_CELLS_PER_MODULE;
+        ltc_minmax.voltage_cell_number_max = ltc_voltage_max_index%BS_NR_OF_BAT_CELLS_PER_MODULE;
+    }
     DATA_StoreDataBlock(&ltc_cellvoltage,DATA_BLOCK_ID_CELLVOLTAGE);
     DATA_StoreDataBlock(&ltc_minmax,DATA_BLOCK_ID_MINMAX);
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+    LTC_SYNC_VoltagesRead(&ltc_cellvoltage);
+#endif
 
 }
 
@@ -347,7 +412,7 @@ static void LTC_SaveVoltages(void) {
  *
  * This function loops through the temperature and multiplexer feedback data of all modules
  * in the LTC daisy-chain that are stored in the LTC_MultiplexerVoltages buffer and writes
- * them in the database.
+ * them in the database. The temperatures of a module are converted at once by LTC_NTC_ConvertModule().
  * At each write iteration, the variables named "state" and related to temperatures and multiplexer feedbacks
  * in the database are incremented.
  *
@@ -358,14 +423,13 @@ static void LTC_SaveTemperatures_SaveBalancingFeedback(void) {
 
     uint16_t i = 0;
     uint16_t j = 0;
-    uint8_t sensor_idx = 0;
     uint8_t ch_idx = 0;
     uint16_t val_ui = 0;
-    int16_t val_si = 0;
     float  val_fl = 0.0;
+    int16_t temperature[BS_NR_OF_TEMP_SENSORS_PER_MODULE];
 
     int16_t min = 0;
-    uint16_t max = 0;
+    int16_t max = 0;
     int32_t mean = 0;
     uint8_t module_number_min = 0;
     uint8_t module_number_max = 0;
@@ -375,6 +439,19 @@ static void LTC_SaveTemperatures_SaveBalancingFeedback(void) {
     LTC_MUX_CH_CFG_s *muxseqptr;    // pointer to measurement Sequence of Mux- and Channel-Configurations (1,-1)...(3,-1),(0,1),...(0,7)
     LTC_MUX_CH_CFG_s *muxseqendptr; // pointer to ending point of sequence
 
+    for (i=0;i<BS_NR_OF_MODULES;i++) {
+        LTC_NTC_ConvertModule(&LTC_MultiplexerVoltages[2*(LTC_NUMBER_OF_LTC_PER_MODULE*i*LTC_N_MUX_CHANNELS_PER_LTC)], temperature);     // raw values, first LTC of the module
+        for (j=0;j<BS_NR_OF_TEMP_SENSORS_PER_MODULE;j++) {
+            // 0.1 -> 1 degree Celsius
+            if (temperature[j] >= 0) {
+                ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j] = (temperature[j]+5)/10;
+            }
+            else {
+                ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+j] = -((-temperature[j]+5)/10);
+            }
+        }
+    }
+
     muxseqptr = ltc_mux_seq.seqptr;
     muxseqendptr = ((LTC_MUX_CH_CFG_s *)ltc_mux_seq.seqptr)+ltc_mux_seq.nr_of_steps; // last sequence + 1
 
@@ -383,27 +460,6 @@ static void LTC_SaveTemperatures_SaveBalancingFeedback(void) {
         // last step of sequence not reached
         if (muxseqptr->muxCh != 0xff) {
 
-            if (muxseqptr->muxID <= 1) {    // muxID 0 or 1, // typically temperature multiplexer type
-                for (i=0;i<BS_NR_OF_MODULES;i++)
-                {
-                    val_ui=*((uint16_t *)(&LTC_MultiplexerVoltages[2*((LTC_NUMBER_OF_LTC_PER_MODULE*i*LTC_N_MUX_CHANNELS_PER_LTC)+muxseqptr->muxID*LTC_N_MUX_CHANNELS_PER_MUX+muxseqptr->muxCh)]));        // raw values, all mux on all LTCs
-                    val_fl = ((float)(val_ui))*100e-6;        // Unit -> in V
-                    //if multiplexer 1 is used, the indices must be adapted
-                    if (muxseqptr->muxID==0) {
-                        sensor_idx = ltc_muxsensortemperatur_cfg[muxseqptr->muxCh];
-                    }
-                    else {
-                        sensor_idx = ltc_muxsensortemperatur_cfg[muxseqptr->muxCh+8];
-                    }
-                    if (sensor_idx >= BS_NR_OF_TEMP_SENSORS_PER_MODULE)
-                        return;
-
-                    val_si = (int16_t)(LTC_Convert_MuxVoltages_to_Temperatures(val_fl));
-                    ltc_celltemperature.temperature[i*(BS_NR_OF_TEMP_SENSORS_PER_MODULE)+sensor_idx]=val_si;
-
-                }
-            }
-
             if (muxseqptr->muxID >= 2 && muxseqptr->muxID <= 3) // muxID 2 or 3
             {    // typically balancing multiplexer type
                 for (i=0;i<BS_NR_OF_MODULES;i++) {
@@ -482,27 +538,6 @@ static void LTC_Get_BalancingControlValues(void) {
 }
 
 
-/**
- * @brief   converts a raw voltage from multiplexer to a temperature value in Celsius.
- *
- * The temperatures are read from NTC elements via voltage dividers.
- * This function implements the look-up table between voltage and temperature,
- * taking into account the NTC characteristics and the voltage divider.
- *
- * @param   Vout            voltage read from the multiplexer in V
- *
- * @return  temperature     temperature value in Celsius
- */
-static float LTC_Convert_MuxVoltages_to_Temperatures(float Vout) {
-
-    float temperature = 0.0;
-
-    //Dummy function, must be adapted to the application
-    temperature = 10 * Vout;
-
-    return temperature;
-}
-
 /**
  * @brief   re-entrance check of LTC state machine trigger function
  *
@@ -606,13 +641,23 @@ LTC_RETURN_TYPE_e LTC_SetStateRequest(LTC_STATE_REQUEST_e statereq, LTC_ADCMODE_
     return (retVal);
 }
 
+void LTC_GetPipelineTimeline(LTC_PIPELINE_TIMELINE_s *timeline)
+{
+    taskENTER_CRITICAL();
+    *timeline = ltc_pipeline_timeline;
+    taskEXIT_CRITICAL();
+}
+
 void LTC_Trigger(void)
 {
     uint8_t mux_error=0;
+    uint8_t muxPECValid = TRUE;
+    LTC_MUX_CH_CFG_s *muxstep = NULL_PTR;
 
     STD_RETURN_TYPE_e retVal=E_OK;
     LTC_STATE_REQUEST_e statereq=LTC_STATE_NO_REQUEST;
     uint8_t tmpbusID=0;
+    uint8_t balancingWritten = FALSE;
     LTC_ADCMODE_e tmpadcMode=LTC_ADCMODE_UNDEFINED;
     LTC_ADCMEAS_CHAN_e tmpadcMeasCh=LTC_ADCMEAS_UNDEFINED;
 
@@ -630,7 +675,31 @@ void LTC_Trigger(void)
             return;    // handle state machine only if timer has elapsed
         }
     }
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+    LTC_TIMING_TimerElapsed();
+#endif
+
+    // the frames are transferred by DMA: wait until the frames queued in the last step are finished
+    if(LTC_TransferFinished() == FALSE)
+    {
+        ltc_state.triggerentry--;
+        return;
+    }
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+    LTC_TIMING_StepStart();
+#endif
 
+#if LTC_KEEPALIVE == TRUE
+    if((ltc_state.state >= LTC_STATEMACH_INITIALIZED) && (ltc_state.state < LTC_STATEMACH_UNDEFINED) &&
+            (LTC_KEEPALIVE_GetState() == LTC_KEEPALIVE_ASLEEP))
+    {
+        // no valid command for tSLEEP: the configuration is possibly lost, wake up (LTC_TWAKE_US per LTC) and configure again
+        LTC_SAVELASTSTATES();
+        ltc_state.state = LTC_STATEMACH_INITIALIZATION;
+        ltc_state.substate = LTC_ENTRY_INITIALIZATION;
+        ltc_state.ErrRetryCounter = 0;
+    }
+#endif
 
     switch(ltc_state.state) {
         /****************************UNINITIALIZED***********************************/
@@ -661,15 +730,31 @@ void LTC_Trigger(void)
         case LTC_STATEMACH_INITIALIZATION:
 
             LTC_SetTransferTimes();
-            ltc_state.muxmeas_seqptr = ltc_mux_seq.seqptr;
-            ltc_state.muxmeas_nr_end = ltc_mux_seq.nr_of_steps;
-            ltc_state.muxmeas_seqendptr = ((LTC_MUX_CH_CFG_s *)ltc_mux_seq.seqptr)+ltc_mux_seq.nr_of_steps; // last sequence + 1
+            LTC_MUXSCHED_Init();
+            LTC_RestartMuxSequence();
 
             if(ltc_state.substate == LTC_ENTRY_INITIALIZATION)
             {
                 LTC_SAVELASTSTATES();
                 LTC_Initialize_Database();
                 LTC_ResetErrorTable();
+                ltc_balancing_shadow_valid = FALSE;     // LTC_Init() writes the default configuration
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+                LTC_SPICLK_Init();
+#endif
+#if LTC_MUX_FRAME_CACHE == TRUE
+                LTC_BuildMuxFrameCache();
+#endif
+#if LTC_KEEPALIVE == TRUE
+                if(LTC_KEEPALIVE_GetState() == LTC_KEEPALIVE_AWAKE)
+                {
+                    // re-initialization while the daisy-chain is awake: no wake-up sequence needed
+                    ltc_state.ErrRetryCounter = 0;
+                    ltc_state.substate = LTC_START_INIT_INITIALIZATION;
+                    ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                    break;
+                }
+#endif
                 retVal = LTC_SendWakeUp();        // Send dummy byte to wake up the daisy chain
 
                 if(retVal != E_OK)
@@ -811,6 +896,16 @@ void LTC_Trigger(void)
                 ltc_state.adcMode = tmpadcMode;
                 ltc_state.adcMeasCh = LTC_ADCMEAS_ALLCHANNEL;
             }
+            else if(statereq == LTC_STATE_PIPELINEDMEASUREMENT_REQUEST)
+            {
+                LTC_SAVELASTSTATES();
+                ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                ltc_state.state = LTC_STATEMACH_PIPELINEDMEASUREMENT;
+                ltc_state.substate = LTC_ENTRY_PIPELINEDMEASUREMENT;
+                ltc_state.ErrRetryCounter = 0;
+                ltc_state.adcMode = tmpadcMode;
+                ltc_state.adcMeasCh = LTC_ADCMEAS_ALLCHANNEL;
+            }
             else if(statereq == LTC_STATE_BALANCECONTROL_REQUEST)
             {
                 LTC_SAVELASTSTATES();
@@ -853,6 +948,12 @@ void LTC_Trigger(void)
             retVal=LTC_StartVoltageMeasurement(ltc_state.adcMode, ltc_state.adcMeasCh);
             ltc_cellvoltage.previous_timestamp = ltc_cellvoltage.timestamp;
             ltc_cellvoltage.timestamp = MCU_GetTimeStamp();
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+            if(retVal == E_OK)
+            {
+                LTC_SYNC_ConversionStarted(MCU_GetTime_us() + ltc_state.commandTransferTime_us, ltc_state.adcMode);
+            }
+#endif
 
             LTC_SAVELASTSTATES();
             if((retVal != E_OK))
@@ -907,7 +1008,7 @@ void LTC_Trigger(void)
             {
                 if(ltc_state.lastsubstate == LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE)
                 {
-                    if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK)
+                    if(LTC_DecodeVoltageRegister(0, ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK)
                     {
                         if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
                         {
@@ -919,7 +1020,7 @@ void LTC_Trigger(void)
                                 break;
                             }
                         }
-                        else
+                        else if(LTC_RetryVoltageRegister() == TRUE)
                         {
                             ltc_state.lastsubstate = ltc_state.substate;
                             ltc_state.substate=LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE;
@@ -930,7 +1031,6 @@ void LTC_Trigger(void)
                     LTC_ResetErrorTable();
                     ltc_state.ErrRetryCounter = 0;
                     ltc_state.ErrPECCounter = 0;
-                    LTC_SaveRXtoVoltagebuffer(0, ltc_DataBufferSPI_RX_with_PEC_voltages);
                 }
 
                 ltc_state.lastsubstate = ltc_state.substate;
@@ -958,7 +1058,7 @@ void LTC_Trigger(void)
             {
                 if(ltc_state.lastsubstate == LTC_READ_VOLTAGE_REGISTER_B_RDCVB_READVOLTAGE)
                 {
-                    if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_voltages)!=E_OK)
+                    if(LTC_DecodeVoltageRegister(1, ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK)
                     {
                         if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
                         {
@@ -970,7 +1070,7 @@ void LTC_Trigger(void)
                                 break;
                             }
                         }
-                        else
+                        else if(LTC_RetryVoltageRegister() == TRUE)
                         {
                             ltc_state.lastsubstate = ltc_state.substate;
                             ltc_state.substate = LTC_READ_VOLTAGE_REGISTER_B_RDCVB_READVOLTAGE;
@@ -981,7 +1081,6 @@ void LTC_Trigger(void)
                     LTC_ResetErrorTable();
                     ltc_state.ErrRetryCounter = 0;
                     ltc_state.ErrPECCounter = 0;
-                    LTC_SaveRXtoVoltagebuffer(1, ltc_DataBufferSPI_RX_with_PEC_voltages);
                 }
 
                 ltc_state.lastsubstate = ltc_state.substate;
@@ -1009,7 +1108,7 @@ void LTC_Trigger(void)
             {
                 if(ltc_state.lastsubstate == LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE)
                 {
-                    if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_voltages)!=E_OK)
+                    if(LTC_DecodeVoltageRegister(2, ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK)
                     {
                         if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
                         {
@@ -1021,7 +1120,7 @@ void LTC_Trigger(void)
                                 break;
                             }
                         }
-                        else
+                        else if(LTC_RetryVoltageRegister() == TRUE)
                         {
                             ltc_state.lastsubstate = ltc_state.substate;
                             ltc_state.substate = LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE;
@@ -1032,7 +1131,6 @@ void LTC_Trigger(void)
                     LTC_ResetErrorTable();
                     ltc_state.ErrRetryCounter = 0;
                     ltc_state.ErrPECCounter = 0;
-                    LTC_SaveRXtoVoltagebuffer(2, ltc_DataBufferSPI_RX_with_PEC_voltages);
                 }
 
                 ltc_state.lastsubstate = ltc_state.substate;
@@ -1051,16 +1149,21 @@ void LTC_Trigger(void)
                 }
                 else
                 {
+#if LTC_N_VOLTAGE_REGISTER_GROUPS > 4
+                    ltc_state.substate=LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE;
+#else
                     ltc_state.substate=LTC_EXIT_READVOLTAGE;
+#endif
                     ltc_state.ErrRetryCounter=0;
                     ltc_state.timer = ltc_state.commandDataTransferTime;
                 }
             }
-            else if (ltc_state.substate == LTC_EXIT_READVOLTAGE)
+#if LTC_N_VOLTAGE_REGISTER_GROUPS > 4
+            else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE)
             {
                 if(ltc_state.lastsubstate == LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE)
                 {
-                    if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_voltages)!=E_OK)
+                    if(LTC_DecodeVoltageRegister(3, ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK)
                     {
                         if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
                         {
@@ -1072,10 +1175,111 @@ void LTC_Trigger(void)
                                 break;
                             }
                         }
-                        else
+                        else if(LTC_RetryVoltageRegister() == TRUE)
+                        {
+                            ltc_state.lastsubstate = ltc_state.substate;
+                            ltc_state.substate = LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE;
+                            ltc_state.timer = LTC_STATEMACH_PECERRTIME;
+                            break;
+                        }
+                    }
+                    LTC_ResetErrorTable();
+                    ltc_state.ErrRetryCounter = 0;
+                    ltc_state.ErrPECCounter = 0;
+                }
+
+                ltc_state.lastsubstate = ltc_state.substate;
+                retVal = LTC_RX( (uint8_t*)ltc_cmdRDCVE, ltc_DataBufferSPI_RX_with_PEC_voltages);
+                if(retVal != E_OK)
+                {
+                    ++(ltc_state.ErrRetryCounter);
+                    ltc_state.timer = LTC_STATEMACH_SEQERRTTIME;
+                    if (ltc_state.ErrRetryCounter>LTC_TRANSMIT_SPIERRLIMIT)
+                    {
+                        ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                        ltc_state.state = LTC_STATEMACH_ERROR_SPIFAILED;
+                        ltc_state.substate = LTC_ERROR_ENTRY;
+                        break;
+                    }
+                }
+                else
+                {
+                    ltc_state.substate = LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE;
+                    ltc_state.ErrRetryCounter = 0;
+                    ltc_state.timer = ltc_state.commandDataTransferTime;
+                }
+            }
+            else if (ltc_state.substate == LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE)
+            {
+                if(ltc_state.lastsubstate == LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE)
+                {
+                    if(LTC_DecodeVoltageRegister(4, ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK)
+                    {
+                        if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
+                        {
+                            if (LTC_DISCARD_PEC_CHECK == FALSE)
+                            {
+                                ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                                ltc_state.state = LTC_STATEMACH_ERROR_PECFAILED;
+                                ltc_state.substate = LTC_ERROR_ENTRY;
+                                break;
+                            }
+                        }
+                        else if(LTC_RetryVoltageRegister() == TRUE)
+                        {
+                            ltc_state.lastsubstate = ltc_state.substate;
+                            ltc_state.substate = LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE;
+                            ltc_state.timer = LTC_STATEMACH_PECERRTIME;
+                            break;
+                        }
+                    }
+                    LTC_ResetErrorTable();
+                    ltc_state.ErrRetryCounter = 0;
+                    ltc_state.ErrPECCounter = 0;
+                }
+
+                ltc_state.lastsubstate = ltc_state.substate;
+                retVal = LTC_RX( (uint8_t*)ltc_cmdRDCVF, ltc_DataBufferSPI_RX_with_PEC_voltages);
+                if(retVal != E_OK)
+                {
+                    ++(ltc_state.ErrRetryCounter);
+                    ltc_state.timer = LTC_STATEMACH_SEQERRTTIME;
+                    if (ltc_state.ErrRetryCounter>LTC_TRANSMIT_SPIERRLIMIT)
+                    {
+                        ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                        ltc_state.state = LTC_STATEMACH_ERROR_SPIFAILED;
+                        ltc_state.substate = LTC_ERROR_ENTRY;
+                        break;
+                    }
+                }
+                else
+                {
+                    ltc_state.substate = LTC_EXIT_READVOLTAGE;
+                    ltc_state.ErrRetryCounter = 0;
+                    ltc_state.timer = ltc_state.commandDataTransferTime;
+                }
+            }
+#endif
+            else if (ltc_state.substate == LTC_EXIT_READVOLTAGE)
+            {
+                if(ltc_state.lastsubstate == LTC_READ_VOLTAGE_REGISTER_LAST_READVOLTAGE)
+                {
+                    if(LTC_DecodeVoltageRegister(LTC_N_VOLTAGE_REGISTER_GROUPS-1, ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK)
+                    {
+                        if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
+                        {
+                            if (LTC_DISCARD_PEC_CHECK == FALSE)
+                            {
+                                ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                                ltc_state.state = LTC_STATEMACH_ERROR_PECFAILED;
+                                ltc_state.substate = LTC_ERROR_ENTRY;
+                                break;
+                            }
+                        }
+                        else if(LTC_RetryVoltageRegister() == TRUE)
                         {
                             ltc_state.lastsubstate = ltc_state.substate;
-                            ltc_state.substate=LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE;
+                            ltc_state.substate=LTC_READ_VOLTAGE_REGISTER_LAST_READVOLTAGE;
                             ltc_state.timer = LTC_STATEMACH_PECERRTIME;
                             break;
                         }
@@ -1083,7 +1287,6 @@ void LTC_Trigger(void)
                     LTC_ResetErrorTable();
                     ltc_state.ErrRetryCounter = 0;
                     ltc_state.ErrPECCounter = 0;
-                    LTC_SaveRXtoVoltagebuffer(3, ltc_DataBufferSPI_RX_with_PEC_voltages);
                 }
 
                 ltc_state.timer = LTC_STATEMACH_SHORTTIME;
@@ -1097,7 +1300,7 @@ void LTC_Trigger(void)
         case LTC_STATEMACH_BALANCECONTROL:
             if(ltc_state.substate == LTC_ENTRY_BALANCECONTROL)
             {
-                retVal = LTC_BalanceControl();
+                retVal = LTC_BalanceControl(&balancingWritten);
                 ltc_state.lastsubstate = ltc_state.substate;
                 ltc_state.laststate = ltc_state.state;
                 if(retVal != 0)
@@ -1113,13 +1316,81 @@ void LTC_Trigger(void)
                     }
 
                 }
+                else if(balancingWritten == TRUE || ++ltc_balancing_verify_counter >= LTC_BALANCING_VERIFY_PERIOD)
+                {
+                    // read back after each write, otherwise only every LTC_BALANCING_VERIFY_PERIOD balance controls
+                    ltc_balancing_verify_counter = 0;
+                    ltc_state.timer = (balancingWritten == TRUE) ? ltc_state.commandDataTransferTime : LTC_STATEMACH_SHORTTIME;
+                    ltc_state.ErrRetryCounter = 0;
+                    ltc_state.ErrPECCounter = 0;
+                    ltc_state.substate = LTC_READ_CFG_BALANCECONTROL;
+                }
                 else
                 {
-                    ltc_state.timer = ltc_state.commandDataTransferTime;
+#if LTC_KEEPALIVE == FALSE
+                    // balancing unchanged: only a dummy byte, otherwise the isoSPI ports can become idle and lose the next command
+                    (void)LTC_SendWakeUp();
+#endif
+                    ltc_state.timer = LTC_STATEMACH_SHORTTIME;
                     ltc_state.ErrRetryCounter = 0;
                     ltc_state.substate = LTC_EXIT_BALANCECONTROL;
                 }
             }
+            else if(ltc_state.substate == LTC_READ_CFG_BALANCECONTROL)
+            {
+                LTC_SAVELASTSTATES();
+                retVal = LTC_RX((uint8_t*)ltc_cmdRDCFG, ltc_DataBufferSPI_RX_with_PEC_balancing);
+                if(retVal != E_OK)
+                {
+                    ++ltc_state.ErrRetryCounter;
+                    ltc_state.timer = LTC_STATEMACH_SEQERRTTIME;
+                    if (ltc_state.ErrRetryCounter>LTC_TRANSMIT_SPIERRLIMIT)
+                    {
+                        ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                        ltc_state.state = LTC_STATEMACH_ERROR_SPIFAILED;
+                        ltc_state.substate = LTC_ERROR_ENTRY;
+                        break;
+                    }
+                }
+                else
+                {
+                    ltc_state.timer = ltc_state.commandDataTransferTime;
+                    ltc_state.ErrRetryCounter = 0;
+                    ltc_state.substate = LTC_CHECK_CFG_BALANCECONTROL;
+                }
+            }
+            else if(ltc_state.substate == LTC_CHECK_CFG_BALANCECONTROL)
+            {
+                if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_balancing)!=E_OK)
+                {
+                    if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
+                    {
+                        if (LTC_DISCARD_PEC_CHECK == FALSE)
+                        {
+                            ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                            ltc_state.state = LTC_STATEMACH_ERROR_PECFAILED;
+                            ltc_state.substate = LTC_ERROR_ENTRY;
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        ltc_state.lastsubstate = ltc_state.substate;
+                        ltc_state.substate = LTC_READ_CFG_BALANCECONTROL;
+                        ltc_state.timer = LTC_STATEMACH_PECERRTIME;
+                        break;
+                    }
+                }
+                else
+                {
+                    LTC_CheckBalancingRegisters(ltc_DataBufferSPI_RX_with_PEC_balancing);
+                }
+                LTC_ResetErrorTable();
+                ltc_state.ErrPECCounter = 0;
+                LTC_SAVELASTSTATES();
+                ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                ltc_state.substate = LTC_EXIT_BALANCECONTROL;
+            }
             else if(ltc_state.substate == LTC_EXIT_BALANCECONTROL)
             {
                 ltc_state.timer = LTC_STATEMACH_SHORTTIME;        // wait 1ms
@@ -1159,8 +1430,8 @@ void LTC_Trigger(void)
             if(ltc_state.substate == LTC_SET_MUX_CHANNEL_WRCOMM_MUXMEASUREMENT_CONFIG)
             {
                 retVal = LTC_SetMuxChannel( ltc_DataBufferSPI_TX_temperatures, ltc_DataBufferSPI_TX_with_PEC_temperatures,
-                                            ltc_state.muxmeas_seqptr->muxID,  /* mux */
-                                            ltc_state.muxmeas_seqptr->muxCh  /* channel */ );
+                                            ltc_state.muxmeas_groupptr->muxID,  /* mux */
+                                            ltc_state.muxmeas_groupptr->muxCh  /* channel */ );
                 ltc_state.lastsubstate = ltc_state.substate;
                 ltc_state.laststate = ltc_state.state;
                 if(retVal != 0)
@@ -1185,7 +1456,7 @@ void LTC_Trigger(void)
             else if(ltc_state.substate == LTC_SEND_CLOCK_STCOMM_MUXMEASUREMENT_CONFIG)
             {
                 ltc_state.lastsubstate = ltc_state.substate;
-                retVal = LTC_I2CClock(ltc_DataBufferSPI_TX_ClockCycles, ltc_DataBufferSPI_TX_ClockCycles_with_PEC);
+                retVal = LTC_I2CClock();
                 if(retVal != E_OK)
                 {
                     ++ltc_state.ErrRetryCounter;
@@ -1258,7 +1529,7 @@ void LTC_Trigger(void)
                     }
                     LTC_ResetErrorTable();
                     ltc_state.ErrPECCounter = 0;
-                    mux_error=LTC_I2CCheckACK(ltc_DataBufferSPI_RX_with_PEC_temperatures, ltc_state.muxmeas_seqptr->muxID);
+                    mux_error=LTC_I2CCheckACK(ltc_DataBufferSPI_RX_with_PEC_temperatures, ltc_state.muxmeas_groupptr->muxID, ltc_state.muxmeas_groupptr->muxCh);
                     if(mux_error!=0)
                     {
                         if (LTC_DISCARD_MUX_CHECK == FALSE)
@@ -1273,10 +1544,19 @@ void LTC_Trigger(void)
 
                 ltc_state.lastsubstate=ltc_state.substate;
 
-                if(ltc_state.muxmeas_seqptr->muxCh == 0xFF)
+                if((ltc_state.muxmeas_groupptr+1) < ltc_state.muxmeas_groupendptr)
+                {    // set the channel of the next multiplexer of the group before the GPIO conversion
+                    ++ltc_state.muxmeas_groupptr;
+                    ltc_state.substate = LTC_SET_MUX_CHANNEL_WRCOMM_MUXMEASUREMENT_CONFIG;
+                    ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+                    ltc_state.ErrRetryCounter = 0;
+                    break;
+                }
+                else if(ltc_state.muxmeas_gpiomask == 0)
                 {    // actual multiplexer is switched off, so do not make a measurement and follow up with next step (mux configuration)
-                    ++ltc_state.muxmeas_seqptr;         /* go further with next step of sequence
-                                                           ltc_state.numberOfMeasuredMux not decremented, this does not count as a measurement */
+                    ltc_state.muxmeas_seqptr = ltc_state.muxmeas_groupendptr;   /* go further with next step of sequence
+                                                                                   ltc_state.numberOfMeasuredMux not decremented, this does not count as a measurement */
+                    LTC_StartMuxGroup();
                     ltc_state.lastsubstate = ltc_state.substate;
                     ltc_state.substate = LTC_SET_MUX_CHANNEL_WRCOMM_MUXMEASUREMENT_CONFIG;
                     ltc_state.state = LTC_STATEMACH_MUXMEASUREMENT_CONFIG;
@@ -1286,7 +1566,7 @@ void LTC_Trigger(void)
                 }
                 else
                 {
-                    retVal=LTC_StartGPIOMeasurement(ltc_state.adcMode, ltc_state.adcMeasCh);
+                    retVal=LTC_StartGPIOMeasurement(ltc_state.adcMode, LTC_GetMuxGroupMeasCh());
                     if(retVal != E_OK)
                     {
                         ++ltc_state.ErrRetryCounter;
@@ -1304,7 +1584,7 @@ void LTC_Trigger(void)
                         LTC_SAVELASTSTATES();
                         ltc_state.state = LTC_STATEMACH_MUXMEASUREMENT;
                         ltc_state.substate = LTC_READ_AUXILIARY_REGISTER_A_RAUXA_MUXMEASUREMENT;
-                        ltc_state.timer = ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode,ltc_state.adcMeasCh); // wait, ADAX-Command
+                        ltc_state.timer = ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode,LTC_GetMuxGroupMeasCh()); // wait, ADAX-Command
                         ltc_state.ErrRetryCounter = 0;
                     }
                 }
@@ -1346,6 +1626,7 @@ void LTC_Trigger(void)
             else if(ltc_state.substate == LTC_SAVE_MUX_MEASUREMENT_MUXMEASUREMENT)
             {
                 ltc_state.lastsubstate=ltc_state.substate;
+                muxPECValid = TRUE;
                 if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_temperatures)!=E_OK)
                 {
                     if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
@@ -1358,20 +1639,26 @@ void LTC_Trigger(void)
                             break;
                         }
                     }
+                    else
+                    {
+                        muxPECValid = FALSE;    // frame kept as before, but not reported to the multiplexer schedule
+                    }
                 }
                 LTC_ResetErrorTable();
-                LTC_SaveMuxMeasurement(ltc_DataBufferSPI_RX_with_PEC_temperatures, ltc_state.muxmeas_seqptr);
+                for(muxstep=ltc_state.muxmeas_seqptr;muxstep<ltc_state.muxmeas_groupendptr;muxstep++)
+                {
+                    LTC_SaveMuxMeasurement(ltc_DataBufferSPI_RX_with_PEC_temperatures, muxstep, muxPECValid);
+                }
 
-                ++(ltc_state.muxmeas_seqptr);        // go further with next step of sequence
+                ltc_state.muxmeas_seqptr = ltc_state.muxmeas_groupendptr;        // go further with next step of sequence
+                LTC_StartMuxGroup();
                 --(ltc_state.numberOfMeasuredMux);
                 if(ltc_state.muxmeas_seqptr >= ltc_state.muxmeas_seqendptr)
                 {    // last step of sequence reached
                     // The mux sequence starts again
                     ltc_muxcycle_finished = E_OK;
 
-                    ltc_state.muxmeas_seqptr = ltc_mux_seq.seqptr;
-                    ltc_state.muxmeas_nr_end = ltc_mux_seq.nr_of_steps;
-                    ltc_state.muxmeas_seqendptr = ((LTC_MUX_CH_CFG_s *)ltc_mux_seq.seqptr)+ltc_mux_seq.nr_of_steps; // last sequence + 1
+                    LTC_RestartMuxSequence();
 
                     ltc_state.timer = LTC_STATEMACH_SHORTTIME;
                     LTC_SAVELASTSTATES();
@@ -1558,8 +1845,19 @@ void LTC_Trigger(void)
             }
             break;
 
-        /****************************SPI ERROR***************************************/
-        case LTC_STATEMACH_ERROR_SPIFAILED:
+        /****************************PIPELINED MEASUREMENT***************************/
+        case LTC_STATEMACH_PIPELINEDMEASUREMENT:
+            if(ltc_state.substate == LTC_ENTRY_PIPELINEDMEASUREMENT)
+            {
+                LTC_PipelineInit();
+                ltc_state.lastsubstate = ltc_state.substate;
+                ltc_state.substate = LTC_SCHEDULE_PIPELINEDMEASUREMENT;
+            }
+            LTC_PipelineSchedule();
+            break;
+
+        /****************************SPI ERROR***************************************/
+        case LTC_STATEMACH_ERROR_SPIFAILED:
             if(ltc_state.substate == LTC_ERROR_ENTRY)
             {
                 DIAG_Handler(DIAG_CH_LTC_SPI,DIAG_EVENT_NOK,0, NULL);
@@ -1587,6 +1885,9 @@ void LTC_Trigger(void)
             if(ltc_state.substate == LTC_ERROR_ENTRY)
             {
                 DIAG_Handler(DIAG_CH_COM_LTC_PEC,DIAG_EVENT_NOK, 0, NULL);
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+                LTC_SPICLK_PECErrorLimit();     // re-initialize with a slower clock
+#endif
                 ltc_state.substate =  LTC_ERROR_PROCESSED;
             }
 
@@ -1631,6 +1932,9 @@ void LTC_Trigger(void)
             break;
     }
 
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+    LTC_TIMING_StepEnd(ltc_state.state, ltc_state.substate);
+#endif
     ltc_state.triggerentry--;        // reentrance counter
 }
 
@@ -1642,25 +1946,136 @@ void LTC_Trigger(void)
  * After a voltage measurement was initiated on GPIO 1 to read the currently selected
  * multiplexer voltage, the results is read via SPI from the daisy-chain.
  * This function is called to store the result from the transmission in a buffer.
+ * With LTC_MUX_MULTI_GPIO, the result is taken from the GPIO of the multiplexer (ltc_mux_gpio_cfg)
+ * in the auxiliary register group A.
+ * The measured channel is only reported to the multiplexer schedule (LTC_MUXSCHED_ChannelMeasured())
+ * if the frame is valid, a frame with PEC errors neither updates its age nor its temperature range.
  *
  * @param   *DataBufferSPI_RX   buffer containing the data obtained from the SPI transmission
  * @param   muxseqptr           pointer to the multiplexer sequence, which configures the currently selected multiplexer ID and channel
+ * @param   pecValid            FALSE if the frame had PEC errors, TRUE otherwise
  *
  * @return  void
  *
  */
-static void LTC_SaveMuxMeasurement(uint8_t *DataBufferSPI_RX, LTC_MUX_CH_CFG_s  *muxseqptr) {   // pointer to measurement Sequence of Mux- and Channel-Configurations (1,0xFF)...(3,0xFF),(0,1),...(0,7))
+static void LTC_SaveMuxMeasurement(uint8_t *DataBufferSPI_RX, LTC_MUX_CH_CFG_s  *muxseqptr, uint8_t pecValid) {   // pointer to measurement Sequence of Mux- and Channel-Configurations (1,0xFF)...(3,0xFF),(0,1),...(0,7))
 
     uint16_t i = 0;
+    uint16_t val_ui = 0;
+    int16_t val_si = 0;
+    int16_t temperature_min = INT16_MAX;
+    int16_t temperature_max = INT16_MIN;
+    uint8_t isTemperature = FALSE;
+    LTC_NTC_TYPE_e type = LTC_NTC_10K_B3435;
+    uint8_t offset = 0;     // GPIO1
 
     if(muxseqptr->muxCh == 0xFF)
         return; /* Channel 0xFF means that the multiplexer is deactivated, therefore no measurement will be made and saved*/
 
+#if LTC_MUX_MULTI_GPIO == TRUE
+    offset = 2*ltc_mux_gpio_cfg[muxseqptr->muxID];
+#endif
+
+    for (i=0;i<BS_NR_OF_TEMP_SENSORS_PER_MODULE;i++) {
+        if((ltc_tempsensor_cfg[i].muxID == muxseqptr->muxID) && (ltc_tempsensor_cfg[i].muxCh == muxseqptr->muxCh)) {
+            isTemperature = TRUE;
+            type = ltc_tempsensor_cfg[i].type;
+        }
+    }
+
     for (i=0;i<LTC_N_LTC;i++) {
 
-        LTC_MultiplexerVoltages[2*(i*LTC_N_MUX_CHANNELS_PER_LTC+muxseqptr->muxID*LTC_N_MUX_CHANNELS_PER_MUX+muxseqptr->muxCh)] = DataBufferSPI_RX[4+1*i*8];        // raw values, all multiplexers on all LTCs
-        LTC_MultiplexerVoltages[2*(i*LTC_N_MUX_CHANNELS_PER_LTC+muxseqptr->muxID*LTC_N_MUX_CHANNELS_PER_MUX+muxseqptr->muxCh)+1] = DataBufferSPI_RX[4+1*i*8+1];        // raw values, all multiplexers on all LTCs
+        LTC_MultiplexerVoltages[2*(i*LTC_N_MUX_CHANNELS_PER_LTC+muxseqptr->muxID*LTC_N_MUX_CHANNELS_PER_MUX+muxseqptr->muxCh)] = DataBufferSPI_RX[LTC_DATA_OFFSET(i)+offset];        // raw values, all multiplexers on all LTCs
+        LTC_MultiplexerVoltages[2*(i*LTC_N_MUX_CHANNELS_PER_LTC+muxseqptr->muxID*LTC_N_MUX_CHANNELS_PER_MUX+muxseqptr->muxCh)+1] = DataBufferSPI_RX[LTC_DATA_OFFSET(i)+offset+1];        // raw values, all multiplexers on all LTCs
+
+        if(isTemperature == TRUE) {
+            // only used to schedule the multiplexer measurements
+            val_ui = DataBufferSPI_RX[LTC_DATA_OFFSET(i)+offset] | (DataBufferSPI_RX[LTC_DATA_OFFSET(i)+offset+1] << 8);
+            val_si = LTC_NTC_Convert(type, val_ui);
+            if(val_si < temperature_min) {
+                temperature_min = val_si;
+            }
+            if(val_si > temperature_max) {
+                temperature_max = val_si;
+            }
+        }
+    }
+
+    if(pecValid == TRUE) {
+        LTC_MUXSCHED_ChannelMeasured(muxseqptr, isTemperature, temperature_min, temperature_max);
+    }
+}
+
+
+/**
+ * @brief   starts the next round of the multiplexer sequence.
+ *
+ * The sequence is given by LTC_MUXSCHED_NextRound(): the configured sequence ltc_mux_seq or,
+ * with LTC_MUX_ADAPTIVE_SCHEDULING, a round planned from the last measurements.
+ *
+ * @return  void
+ */
+static void LTC_RestartMuxSequence(void) {
+
+    uint8_t nr_of_steps = 0;
+
+    ltc_state.muxmeas_seqptr = LTC_MUXSCHED_NextRound(&nr_of_steps);
+    ltc_state.muxmeas_nr_end = nr_of_steps;
+    ltc_state.muxmeas_seqendptr = ltc_state.muxmeas_seqptr+nr_of_steps;     // last sequence + 1
+    LTC_StartMuxGroup();
+}
+
+
+/**
+ * @brief   starts the group of multiplexer steps beginning at ltc_state.muxmeas_seqptr.
+ *
+ * The steps of a group are set one after the other and measured with one GPIO conversion.
+ * Without LTC_MUX_MULTI_GPIO, a group is one step of the sequence. With LTC_MUX_MULTI_GPIO,
+ * the group contains the following steps as long as each multiplexer is used once and the
+ * measured multiplexers are connected to different GPIOs.
+ *
+ * @return  void
+ */
+static void LTC_StartMuxGroup(void) {
+
+    LTC_MUX_CH_CFG_s *muxstep = ltc_state.muxmeas_seqptr;
+    uint8_t gpiomask = 0;
+#if LTC_MUX_MULTI_GPIO == TRUE
+    uint8_t muxmask = 0;
+    uint8_t gpio = 0;
+
+    while((muxstep < ltc_state.muxmeas_seqendptr) && ((muxmask & (1 << muxstep->muxID)) == 0)) {
+        if(muxstep->muxCh != 0xFF) {
+            gpio = ltc_mux_gpio_cfg[muxstep->muxID];
+            if((gpiomask & (1 << gpio)) != 0) {
+                break;      // GPIO already used by another multiplexer of the group
+            }
+            gpiomask |= (1 << gpio);
+        }
+        muxmask |= (1 << muxstep->muxID);
+        ++muxstep;
+    }
+#else
+    if(muxstep < ltc_state.muxmeas_seqendptr) {
+        gpiomask = (muxstep->muxCh != 0xFF) ? 0x01 : 0;
+        ++muxstep;
     }
+#endif
+
+    ltc_state.muxmeas_groupptr = ltc_state.muxmeas_seqptr;
+    ltc_state.muxmeas_groupendptr = muxstep;
+    ltc_state.muxmeas_gpiomask = gpiomask;
+}
+
+
+/**
+ * @brief   gets the GPIO conversion needed for the current multiplexer group.
+ *
+ * @return  LTC_ADCMEAS_SINGLECHANNEL if only GPIO1 is measured, LTC_ADCMEAS_ALLCHANNEL otherwise
+ */
+static LTC_ADCMEAS_CHAN_e LTC_GetMuxGroupMeasCh(void) {
+
+    return (ltc_state.muxmeas_gpiomask == 0x01) ? LTC_ADCMEAS_SINGLECHANNEL : LTC_ADCMEAS_ALLCHANNEL;
 }
 
 
@@ -1698,65 +2113,124 @@ static void LTC_SaveGPIOMeasurement(uint8_t registerSet, uint8_t *rxBuffer) {
     /* Retrieve data without command and CRC*/
     for(i=0;i<LTC_N_LTC;i++) {
 
-        LTC_GPIOVoltages[0+i_offset+12*i]= rxBuffer[4+i*8];
-        LTC_GPIOVoltages[1+i_offset+12*i]= rxBuffer[5+i*8];
-        LTC_GPIOVoltages[2+i_offset+12*i]= rxBuffer[6+i*8];
-        LTC_GPIOVoltages[3+i_offset+12*i]= rxBuffer[7+i*8];
-        LTC_GPIOVoltages[4+i_offset+12*i]= rxBuffer[8+i*8];
-        LTC_GPIOVoltages[5+i_offset+12*i]= rxBuffer[9+i*8];
+        LTC_GPIOVoltages[0+i_offset+12*i]= rxBuffer[LTC_DATA_OFFSET(i)+0];
+        LTC_GPIOVoltages[1+i_offset+12*i]= rxBuffer[LTC_DATA_OFFSET(i)+1];
+        LTC_GPIOVoltages[2+i_offset+12*i]= rxBuffer[LTC_DATA_OFFSET(i)+2];
+        LTC_GPIOVoltages[3+i_offset+12*i]= rxBuffer[LTC_DATA_OFFSET(i)+3];
+        LTC_GPIOVoltages[4+i_offset+12*i]= rxBuffer[LTC_DATA_OFFSET(i)+4];
+        LTC_GPIOVoltages[5+i_offset+12*i]= rxBuffer[LTC_DATA_OFFSET(i)+5];
     }
 }
 
 /**
- * @brief   saves the voltage values read from the LTC daisy-chain.
+ * @brief   checks and decodes a voltage register group read from the LTC daisy-chain.
  *
  * After a voltage measurement was initiated to measure the voltages of the cells,
  * the result is read via SPI from the daisy-chain.
- * There are 4 register to read _(A,B,C,D) to get all cell voltages.
+ * There are LTC_N_VOLTAGE_REGISTER_GROUPS registers to read (A,B,C,D and E,F for the LTC6813) to get all cell voltages.
  * Only one register can be read at a time.
- * This function is called to store the result from the transmission in a buffer.
- *
- * @param   registerSet    voltage register that was read (voltage register A,B,C or D)
+ * This function runs in one pass over the received frame: for each LTC the PEC is checked,
+ * the raw values (100uV/bit) are converted to mV and written to ltc_cellvoltage, the sum of
+ * the module is updated and the minimum and maximum are tracked.
+ * LTCs with a wrong PEC or whose transfer failed keep their previous values and
+ * are flagged in valid_voltPECs and in LTC_ErrorTable.
+ * While a register group is read again after a PEC error (ltc_voltage_retry), only the LTCs
+ * flagged in LTC_ErrorTable are decoded, their flag is cleared if the PEC is OK now.
+ *
+ * @param   registerSet    voltage register that was read (0: voltage register A, 1: B...)
  * @param   *rxBuffer      buffer containing the data obtained from the SPI transmission
  *
- * @return  void
+ * @return  E_OK if the PECs of all LTCs are OK, E_NOT_OK otherwise
  *
  */
-static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer) {
+static STD_RETURN_TYPE_e LTC_DecodeVoltageRegister(uint8_t registerSet, uint8_t *rxBuffer) {
 
     uint16_t i = 0;
-    uint8_t i_offset=0;
-
+    uint8_t c = 0;
+    uint16_t module = 0;
+    uint16_t cell = 0;
+    uint16_t index = 0;
+    uint16_t voltage = 0;
+    uint8_t *data = NULL_PTR;
+    uint8_t receiveFailed = FALSE;
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+    uint8_t pecFailed = FALSE;
+#endif
+    STD_RETURN_TYPE_e retVal = E_OK;
 
-    if(registerSet == 0) {
-      // RDCVA command -> voltage register group A
-        i_offset=0;
-    }
-    else if(registerSet == 1) {
-    // RDCVB command -> voltage register group B
-        i_offset=6;
-    }
-    else if(registerSet == 2) {
-    // RDCVC command -> voltage register group C
-        i_offset=12;
+    if(registerSet >= LTC_N_VOLTAGE_REGISTER_GROUPS) {
+        return E_NOT_OK;
     }
-    else if(registerSet == 3) {
-    // RDCVD command -> voltage register group D
-        i_offset=18;
+
+    // DMA transfer failed, the buffer contains old data
+    receiveFailed = LTC_ReceiveFailed(ltc_state.rxFrameID);
+
+    if((registerSet == 0) && (ltc_voltage_retry == FALSE)) {
+        // RDCVA command -> voltage register group A: start of a new measurement
+        ltc_voltage_min = 0xFFFF;
+        ltc_voltage_max = 0;
     }
-    else
-        return;
 
-    /* Retrieve data without command and CRC*/
     for(i=0;i<LTC_N_LTC;i++) {
 
-        LTC_CellVoltages[0+i_offset+24*i]= rxBuffer[4+i*8];
-        LTC_CellVoltages[1+i_offset+24*i]= rxBuffer[5+i*8];
-        LTC_CellVoltages[2+i_offset+24*i]= rxBuffer[6+i*8];
-        LTC_CellVoltages[3+i_offset+24*i]= rxBuffer[7+i*8];
-        LTC_CellVoltages[4+i_offset+24*i]= rxBuffer[8+i*8];
-        LTC_CellVoltages[5+i_offset+24*i]= rxBuffer[9+i*8];
+        data = &rxBuffer[LTC_DATA_OFFSET(i)];
+        module = i/LTC_NUMBER_OF_LTC_PER_MODULE;
+        cell = (i%LTC_NUMBER_OF_LTC_PER_MODULE)*LTC_N_CELLS_PER_LTC + registerSet*3;
+
+        if((ltc_voltage_retry == TRUE) && (LTC_ErrorTable[module].LTC[i%LTC_NUMBER_OF_LTC_PER_MODULE] == 0)) {
+            continue;   // data of this LTC was already decoded
+        }
+
+        if((receiveFailed == FALSE) && (LTC_pec15_check(data) == TRUE)) {
+#if LTC_COMM_HEALTH == TRUE
+            LTC_HEALTH_CountFrame(i, FALSE);
+#endif
+            LTC_ErrorTable[module].LTC[i%LTC_NUMBER_OF_LTC_PER_MODULE]=0;
+            for(c=0;(c<3) && (cell<BS_NR_OF_BAT_CELLS_PER_MODULE);c++,cell++) {
+                voltage = (uint16_t)(data[2*c] | (data[2*c+1]<<8))/10;     // Unit 100uV -> in mV
+                index = module*BS_NR_OF_BAT_CELLS_PER_MODULE + cell;
+
+                ltc_cellvoltage.sumOfCells[module] += voltage;
+                ltc_cellvoltage.sumOfCells[module] -= ltc_cellvoltage.voltage[index];
+                ltc_cellvoltage.voltage[index] = voltage;
+                ltc_cellvoltage.valid_voltPECs[module] &= ~((uint32_t)1 << cell);
+
+                // on equal values the cell with the lowest index wins, as in a scan over all cells
+                if ((voltage < ltc_voltage_min) || ((voltage == ltc_voltage_min) && (index < ltc_voltage_min_index))) {
+                    ltc_voltage_min = voltage;
+                    ltc_voltage_min_index = index;
+                }
+                if ((voltage > ltc_voltage_max) || ((voltage == ltc_voltage_max) && (index < ltc_voltage_max_index))) {
+                    ltc_voltage_max = voltage;
+                    ltc_voltage_max_index = index;
+                }
+            }
+        }
+        else {
+            for(c=0;(c<3) && (cell<BS_NR_OF_BAT_CELLS_PER_MODULE);c++,cell++) {
+                ltc_cellvoltage.valid_voltPECs[module] |= ((uint32_t)1 << cell);
+            }
+            // update error table of the corresponding LTC
+            LTC_ErrorTable[module].LTC[i%LTC_NUMBER_OF_LTC_PER_MODULE]=1;
+#if LTC_COMM_HEALTH == TRUE
+            if(receiveFailed == FALSE) {
+                LTC_HEALTH_CountFrame(i, TRUE);
+            }
+#endif
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+            pecFailed = TRUE;
+#endif
+            retVal = E_NOT_OK;
+        }
+    }
+
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+    if(receiveFailed == FALSE) {
+        LTC_SPICLK_CountFrame(pecFailed);
     }
+#endif
+
+    return retVal;
 }
 
 
@@ -1772,38 +2246,47 @@ static void LTC_SaveRXtoVoltagebuffer(uint8_t registerSet, uint8_t *rxBuffer) {
  *
  * @param   *DataBufferSPI_RX    data obtained from the SPI transmission
  * @param   mux                  multiplexer to be addressed (multiplexer ID)
+ * @param   muxCh                channel selected by the transmission, 0xFF if the multiplexer was switched off
  *
  * @return  mux_error            0 is there was no error, 1 if there was errors
  */
-static uint8_t LTC_I2CCheckACK(uint8_t *DataBufferSPI_RX, int mux) {
+static uint8_t LTC_I2CCheckACK(uint8_t *DataBufferSPI_RX, int mux, uint8_t muxCh) {
     uint8_t mux_error = 0;
     uint16_t i = 0;
+#if LTC_COMM_HEALTH == TRUE
+    uint8_t *data = NULL_PTR;
+#endif
 
     for(i=0;i<BS_NR_OF_MODULES;i++) {
         if (mux == 0){
-            if (DataBufferSPI_RX[4+1+LTC_NUMBER_OF_LTC_PER_MODULE*i*8]!=0x07) {    // ACK = 0xX7
+            if (DataBufferSPI_RX[LTC_DATA_OFFSET(LTC_NUMBER_OF_LTC_PER_MODULE*i)+1]!=0x07) {    // ACK = 0xX7
                 LTC_ErrorTable[i].mux0=1;
                 mux_error=1;
             }
         }
         if (mux == 1){
-            if (DataBufferSPI_RX[4+1+LTC_NUMBER_OF_LTC_PER_MODULE*i*8]!=0x27) {
+            if (DataBufferSPI_RX[LTC_DATA_OFFSET(LTC_NUMBER_OF_LTC_PER_MODULE*i)+1]!=0x27) {
                 LTC_ErrorTable[i].mux1=1;
                 mux_error=1;
             }
         }
         if (mux == 2){
-            if (DataBufferSPI_RX[4+1+LTC_NUMBER_OF_LTC_PER_MODULE*i*8]!=0x47) {
+            if (DataBufferSPI_RX[LTC_DATA_OFFSET(LTC_NUMBER_OF_LTC_PER_MODULE*i)+1]!=0x47) {
                 LTC_ErrorTable[i].mux2=1;
                 mux_error=1;
             }
         }
         if (mux == 3){
-            if (DataBufferSPI_RX[4+1+LTC_NUMBER_OF_LTC_PER_MODULE*i*8]!=0x67) {
+            if (DataBufferSPI_RX[LTC_DATA_OFFSET(LTC_NUMBER_OF_LTC_PER_MODULE*i)+1]!=0x67) {
                 LTC_ErrorTable[i].mux3=1;
                 mux_error=1;
             }
         }
+#if LTC_COMM_HEALTH == TRUE
+        // the FCOM nibbles of the address and data byte are 0x7 if the multiplexer acknowledged, 0xF otherwise
+        data = &DataBufferSPI_RX[LTC_DATA_OFFSET(LTC_NUMBER_OF_LTC_PER_MODULE*i)];
+        LTC_HEALTH_CountMuxACK(i, (uint8_t)mux, muxCh, (((data[1] & 0x0F) == 0x07) && ((data[3] & 0x0F) == 0x07)) ? TRUE : FALSE);
+#endif
     }
 
     return mux_error;
@@ -1852,16 +2335,16 @@ static STD_RETURN_TYPE_e LTC_Init(void) {
 
     for(i=0;i<LTC_N_LTC;i++){
 
-        PEC_Check[0]=ltc_DataBufferSPI_TX_with_PEC_init[4+i*8]=ltc_tmpTXbuffer[0+i*6];
-        PEC_Check[1]=ltc_DataBufferSPI_TX_with_PEC_init[5+i*8]=ltc_tmpTXbuffer[1+i*6];
-        PEC_Check[2]=ltc_DataBufferSPI_TX_with_PEC_init[6+i*8]=ltc_tmpTXbuffer[2+i*6];
-        PEC_Check[3]=ltc_DataBufferSPI_TX_with_PEC_init[7+i*8]=ltc_tmpTXbuffer[3+i*6];
-        PEC_Check[4]=ltc_DataBufferSPI_TX_with_PEC_init[8+i*8]=ltc_tmpTXbuffer[4+i*6];
-        PEC_Check[5]=ltc_DataBufferSPI_TX_with_PEC_init[9+i*8]=ltc_tmpTXbuffer[5+i*6];
+        PEC_Check[0]=ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+0]=ltc_tmpTXbuffer[0+i*6];
+        PEC_Check[1]=ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+1]=ltc_tmpTXbuffer[1+i*6];
+        PEC_Check[2]=ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+2]=ltc_tmpTXbuffer[2+i*6];
+        PEC_Check[3]=ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+3]=ltc_tmpTXbuffer[3+i*6];
+        PEC_Check[4]=ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+4]=ltc_tmpTXbuffer[4+i*6];
+        PEC_Check[5]=ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+5]=ltc_tmpTXbuffer[5+i*6];
 
         PEC_result=LTC_pec15_calc(6, PEC_Check);
-        ltc_DataBufferSPI_TX_with_PEC_init[10+i*8]=(uint8_t)((PEC_result>>8)&0xff);
-        ltc_DataBufferSPI_TX_with_PEC_init[11+i*8]=(uint8_t)(PEC_result&0xff);
+        ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+6]=(uint8_t)((PEC_result>>8)&0xff);
+        ltc_DataBufferSPI_TX_with_PEC_init[LTC_DATA_OFFSET(i)+7]=(uint8_t)(PEC_result&0xff);
 
     } //end for
 
@@ -1885,23 +2368,45 @@ static STD_RETURN_TYPE_e LTC_Init(void) {
  *
  * To set balancing for the cells, the corresponding bits have to be written in the configuration register.
  * The LTC driver only executes the balancing orders written by the BMS in the database.
+ * The configuration registers are kept in ltc_DataBufferSPI_TX_with_PEC_balancing: only the PECs of the LTCs
+ * whose balancing changed are recalculated and the daisy-chain is only written if such an LTC exists
+ * (the LTCs of a daisy-chain cannot be written separately).
  *
- * @return  E_OK if dummy byte was sent correctly by SPI, E_NOT_OK otherwise
+ * @param   *written    set to TRUE if the daisy-chain was written, FALSE otherwise
+ *
+ * @return  E_OK if the frame was queued or nothing had to be sent, E_NOT_OK otherwise
  *
  */
-static STD_RETURN_TYPE_e LTC_BalanceControl(void) {
+static STD_RETURN_TYPE_e LTC_BalanceControl(uint8_t *written) {
 
     STD_RETURN_TYPE_e retVal = E_OK;
 
     uint16_t i = 0;
     uint16_t j = 0;
+    uint16_t k = 0;
+    uint16_t PEC_result = 0;
+    uint8_t changed = FALSE;
+
+    *written = FALSE;
 
     LTC_Get_BalancingControlValues();
 
+    if(ltc_balancing_shadow_valid == FALSE) {
+        // all LTCs without balancing, FC = disable all pull-downs
+        for (i=0;i<LTC_N_LTC;i++) {
+            ltc_tmpTXbuffer[0+(i)*6]=0xFC;
+            for (k=1;k<6;k++) {
+                ltc_tmpTXbuffer[k+(i)*6]=0x00;
+            }
+        }
+        LTC_BuildTXFrame((uint8_t*)ltc_cmdRefOn, ltc_tmpTXbuffer, ltc_DataBufferSPI_TX_with_PEC_balancing);
+        ltc_balancing_changed = TRUE;
+        ltc_balancing_shadow_valid = TRUE;
+    }
 
     for (j=0;j<BS_NR_OF_MODULES;j++) {
 
-        i=BS_NR_OF_MODULES-j-1;
+        i=LTC_WRITE_SLOT(j);
 
         // FC = disable all pull-downs
         ltc_tmpTXbuffer[0+(i)*6]=0xFC;
@@ -1948,14 +2453,73 @@ static STD_RETURN_TYPE_e LTC_BalanceControl(void) {
             ltc_tmpTXbuffer[5+(i)*6]|=0x08;
         }
 
+        // compare with the shadow, the PEC is only recalculated if the register changed
+        changed = FALSE;
+        for (k=0;k<6;k++) {
+            if (ltc_DataBufferSPI_TX_with_PEC_balancing[LTC_DATA_OFFSET(i)+k] != ltc_tmpTXbuffer[k+(i)*6]) {
+                ltc_DataBufferSPI_TX_with_PEC_balancing[LTC_DATA_OFFSET(i)+k] = ltc_tmpTXbuffer[k+(i)*6];
+                changed = TRUE;
+            }
+        }
+        if (changed == TRUE) {
+            PEC_result = LTC_pec15_calc(6, &ltc_tmpTXbuffer[(i)*6]);
+            ltc_DataBufferSPI_TX_with_PEC_balancing[LTC_DATA_OFFSET(i)+6]=(uint8_t)((PEC_result>>8)&0xff);
+            ltc_DataBufferSPI_TX_with_PEC_balancing[LTC_DATA_OFFSET(i)+7]=(uint8_t)(PEC_result&0xff);
+            ltc_balancing_changed = TRUE;
+        }
+
     }
 
-    retVal = LTC_TX((uint8_t*)ltc_cmdRefOn, ltc_tmpTXbuffer, ltc_DataBufferSPI_TX_with_PEC_init);
+    if (ltc_balancing_changed == TRUE) {
+        if (LTC_SendData(ltc_DataBufferSPI_TX_with_PEC_balancing) != E_OK) {
+            retVal = E_NOT_OK;      // frame is sent again at the next try
+        }
+        else {
+            ltc_balancing_changed = FALSE;
+            *written = TRUE;
+        }
+    }
 
     return retVal;
 }
 
 
+/*
+ * @brief   compares the configuration registers read back from the LTCs with the written ones.
+ *
+ * If the configuration register of an LTC differs (e.g., lost write or LTC reset by its watchdog),
+ * the daisy-chain is written again at the next balance control.
+ * The GPIO bits and the read-only bit SWTRD of the first byte are not compared.
+ *
+ * @param   *DataBufferSPI_RX_with_PEC   answer of the daisy-chain to RDCFG, PECs already checked
+ *
+ * @return  void
+ *
+ */
+static void LTC_CheckBalancingRegisters(uint8_t *DataBufferSPI_RX_with_PEC) {
+
+    uint16_t i = 0;
+    uint16_t k = 0;
+    uint8_t *written = NULL_PTR;
+    uint8_t *read = NULL_PTR;
+
+    for (i=0;i<LTC_N_LTC;i++) {
+        read = &DataBufferSPI_RX_with_PEC[LTC_DATA_OFFSET(i)];
+        written = &ltc_DataBufferSPI_TX_with_PEC_balancing[LTC_DATA_OFFSET(LTC_WRITE_SLOT(i))];
+
+        // REFON and ADCOPT
+        if ((read[0] & 0x05) != (written[0] & 0x05)) {
+            ltc_balancing_changed = TRUE;
+        }
+        for (k=1;k<6;k++) {
+            if (read[k] != written[k]) {
+                ltc_balancing_changed = TRUE;
+            }
+        }
+    }
+}
+
+
 /*
  * @brief   resets the error table.
  *
@@ -1977,6 +2541,8 @@ static void LTC_ResetErrorTable(void) {
         LTC_ErrorTable[i].mux2=0;
         LTC_ErrorTable[i].mux3=0;
     }
+    // nothing left to read again from single LTCs
+    ltc_voltage_retry = FALSE;
 }
 
 
@@ -2026,6 +2592,20 @@ static uint16_t LTC_Get_MeasurementTCycle(LTC_ADCMODE_e adcMode, LTC_ADCMEAS_CHA
 
             retVal = LTC_STATEMACH_MEAS_SINGLE_FILTERED_TCYCLE;
         }
+    } else if (adcMeasCh == LTC_ADCMEAS_COMBINED) {
+
+        if(adcMode == LTC_ADCMODE_FAST_DCP0 || adcMode == LTC_ADCMODE_FAST_DCP1) {
+
+            retVal = LTC_STATEMACH_MEAS_COMBINED_FAST_TCYCLE;
+        }
+        else if(adcMode == LTC_ADCMODE_NORMAL_DCP0 || adcMode == LTC_ADCMODE_NORMAL_DCP1) {
+
+            retVal = LTC_STATEMACH_MEAS_COMBINED_NORMAL_TCYCLE;
+        }
+        else if(adcMode == LTC_ADCMODE_FILTERED_DCP0 || adcMode == LTC_ADCMODE_FILTERED_DCP1) {
+
+            retVal = LTC_STATEMACH_MEAS_COMBINED_FILTERED_TCYCLE;
+        }
     } else {
 
         retVal = LTC_STATEMACH_MEAS_ALL_NORMAL_TCYCLE;
@@ -2084,6 +2664,54 @@ static STD_RETURN_TYPE_e LTC_StartVoltageMeasurement(LTC_ADCMODE_e adcMode, LTC_
 }
 
 
+#if LTC_COMBINED_CONVERSION == TRUE
+/**
+ * @brief   tells the LTC daisy-chain to start measuring the voltage on all cells and on GPIO1/2 in one conversion.
+ *
+ * This function sends the command ADCVAX (LTC6811, LTC6813) to the daisy-chain via SPI. The results are read
+ * from the cell voltage registers and from the auxiliary register A.
+ *
+ * @param   adcMode     LTC ADCmeasurement mode (fast, normal or filtered)
+ *
+ * @return  retVal      E_OK if the command was sent correctly by SPI, E_NOT_OK otherwise
+ *
+ */
+static STD_RETURN_TYPE_e LTC_StartCombinedMeasurement(LTC_ADCMODE_e adcMode) {
+
+    STD_RETURN_TYPE_e retVal=E_OK;
+
+    if(adcMode == LTC_ADCMODE_FAST_DCP0) {
+
+        retVal = LTC_SendCmd(ltc_cmdADCVAX_fast_DCP0);
+    }
+    else if(adcMode == LTC_ADCMODE_NORMAL_DCP0) {
+
+        retVal = LTC_SendCmd(ltc_cmdADCVAX_normal_DCP0);
+    }
+    else if(adcMode == LTC_ADCMODE_FILTERED_DCP0) {
+
+        retVal = LTC_SendCmd(ltc_cmdADCVAX_filtered_DCP0);
+    }
+    else if(adcMode == LTC_ADCMODE_FAST_DCP1) {
+
+        retVal = LTC_SendCmd(ltc_cmdADCVAX_fast_DCP1);
+    }
+    else if(adcMode == LTC_ADCMODE_NORMAL_DCP1) {
+
+        retVal = LTC_SendCmd(ltc_cmdADCVAX_normal_DCP1);
+    }
+    else if(adcMode == LTC_ADCMODE_FILTERED_DCP1) {
+
+        retVal = LTC_SendCmd(ltc_cmdADCVAX_filtered_DCP1);
+    }
+    else {
+        retVal = E_NOT_OK;
+    }
+    return retVal;
+}
+#endif
+
+
 /**
  * @brief   tells LTC daisy-chain to start measuring the voltage on GPIOS.
  *
@@ -2138,51 +2766,45 @@ static STD_RETURN_TYPE_e LTC_StartGPIOMeasurement(LTC_ADCMODE_e adcMode, LTC_ADC
  * @brief   checks if the data received from the daisy-chain is not corrupt.
  *
  * This function computes the PEC (CRC) from the data received by the daisy-chain.
- * It compares it with the PEC sent by the LTCs.
+ * It compares it with the PEC sent by the LTCs. All LTCs are checked in one pass
+ * by LTC_pec15_check_frame(), the failing ones are flagged in ltc_pec_failmap.
  * If there are errors, the array LTC_ErrorTable is updated to locate the LTCs in daisy-chain
  * that transmitted corrupt data.
  *
  * @param   *DataBufferSPI_RX_with_PEC   data obtained from the SPI transmission
  *
- * @return  retVal                       E_OK if PEC check is OK, E_NOT_OK otherwise
+ * @return  retVal                       E_OK if the PECs of all LTCs are OK, E_NOT_OK otherwise
  *
  */
 static STD_RETURN_TYPE_e LTC_RX_PECCheck(uint8_t *DataBufferSPI_RX_with_PEC) {
 
     uint16_t i = 0;
-    uint16_t j = 0;
+    uint16_t pecErrors = 0;
     STD_RETURN_TYPE_e retVal=E_OK;
-    uint8_t PEC_TX[2];
-    uint16_t PEC_result = 0;
-    uint8_t PEC_Check[6] = {0x00,0x00,0x00,0x00,0x00,0x00};
-
-    // check all PECs and put data without command and PEC in DataBufferSPI_RX (easier to use)
-    for(i=0;i<LTC_N_LTC;i++) {
-
-        PEC_Check[0] = DataBufferSPI_RX_with_PEC[4+i*8];
-        PEC_Check[1] = DataBufferSPI_RX_with_PEC[5+i*8];
-        PEC_Check[2] = DataBufferSPI_RX_with_PEC[6+i*8];
-        PEC_Check[3] = DataBufferSPI_RX_with_PEC[7+i*8];
-        PEC_Check[4] = DataBufferSPI_RX_with_PEC[8+i*8];
-        PEC_Check[5] = DataBufferSPI_RX_with_PEC[9+i*8];
-
-        PEC_result=LTC_pec15_calc(6, PEC_Check);
-        PEC_TX[0]=(uint8_t)((PEC_result>>8)&0xff);
-        PEC_TX[1]=(uint8_t)(PEC_result&0xff);
-
-        // if calculated PEC not equal to received PEC
-        if ( (PEC_TX[0]!=DataBufferSPI_RX_with_PEC[10+i*8]) || (PEC_TX[1]!=DataBufferSPI_RX_with_PEC[11+i*8]) ){
 
-            // update error table of the corresponding LTC
-            j=i%LTC_NUMBER_OF_LTC_PER_MODULE;
-            LTC_ErrorTable[i/LTC_NUMBER_OF_LTC_PER_MODULE].LTC[j]=1;
+    if(LTC_ReceiveFailed(ltc_state.rxFrameID) == TRUE) {
+        return E_NOT_OK;    // DMA transfer failed, the buffer contains old data
+    }
 
-            retVal=E_NOT_OK;
+    // check all PECs of the frame in one pass, the failing LTCs are flagged in ltc_pec_failmap
+    pecErrors = LTC_pec15_check_frame(DataBufferSPI_RX_with_PEC, LTC_N_LTC, ltc_pec_failmap);
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+    LTC_SPICLK_CountFrame((pecErrors > 0) ? TRUE : FALSE);
+#endif
+#if LTC_COMM_HEALTH == TRUE
+    for(i=0;i<LTC_N_LTC;i++) {
+        LTC_HEALTH_CountFrame(i, ((pecErrors > 0) && ((ltc_pec_failmap[i/32] & ((uint32_t)1 << (i%32))) != 0)) ? TRUE : FALSE);
+    }
+#endif
+    if(pecErrors > 0) {
 
+        for(i=0;i<LTC_N_LTC;i++) {
+            if((ltc_pec_failmap[i/32] & ((uint32_t)1 << (i%32))) != 0) {
+                // update error table of the corresponding LTC
+                LTC_ErrorTable[i/LTC_NUMBER_OF_LTC_PER_MODULE].LTC[i%LTC_NUMBER_OF_LTC_PER_MODULE]=1;
+            }
         }
-        else {
-            retVal = E_OK;
-        }
+        retVal=E_NOT_OK;
     }
 
     return (retVal);
@@ -2241,6 +2863,30 @@ static STD_RETURN_TYPE_e LTC_RX(uint8_t *Command, uint8_t *DataBufferSPI_RX_with
 
 
 
+/**
+ * @brief   decides if a cell voltage register group with PEC errors is read again.
+ *
+ * With LTC_TARGETED_PEC_RETRY, the register group is only read again while the conversion
+ * result is not older than LTC_PEC_RETRY_MAXAGE. Then only the LTCs flagged in LTC_ErrorTable
+ * are read and decoded again. Otherwise the data is accepted, the cells of the failing LTCs
+ * stay marked invalid in valid_voltPECs.
+ *
+ * @return  TRUE if the register group is read again, FALSE if the data is accepted
+ */
+static uint8_t LTC_RetryVoltageRegister(void) {
+
+#if LTC_TARGETED_PEC_RETRY == TRUE
+    uint32_t conversionEnd = ltc_cellvoltage.timestamp + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh);
+
+    if((int32_t)(MCU_GetTimeStamp() - conversionEnd) > LTC_PEC_RETRY_MAXAGE) {
+        return FALSE;
+    }
+    ltc_voltage_retry = TRUE;
+#endif
+    return TRUE;
+}
+
+
 /**
  * @brief   sends command and data to the LTC daisy-chain.
  *
@@ -2264,8 +2910,36 @@ static STD_RETURN_TYPE_e LTC_RX(uint8_t *Command, uint8_t *DataBufferSPI_RX_with
  */
 static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC) {
 
-    uint16_t i = 0;
     STD_RETURN_TYPE_e statusSPI = E_NOT_OK;
+
+    LTC_BuildTXFrame(Command, DataBufferSPI_TX, DataBufferSPI_TX_with_PEC);
+
+    statusSPI = LTC_SendData(DataBufferSPI_TX_with_PEC);
+
+    if(statusSPI != E_OK) {
+
+        return E_NOT_OK;
+    }
+    else
+        return E_OK;
+}
+
+
+/**
+ * @brief   builds the frame sent to the LTC daisy-chain by LTC_TX().
+ *
+ * The command with its PEC is copied at the beginning of the frame and
+ * the PEC of the 6 data bytes of each LTC is calculated. Nothing is sent.
+ *
+ * @param   *Command                    command sent to the daisy-chain
+ * @param   *DataBufferSPI_TX           data to be sent to the daisy-chain
+ * @param   *DataBufferSPI_TX_with_PEC  frame to be sent to the daisy-chain, i.e. command + data + PEC
+ *
+ * @return  void
+ */
+static void LTC_BuildTXFrame(uint8_t *Command, uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC) {
+
+    uint16_t i = 0;
     uint16_t PEC_result = 0;
     uint8_t PEC_Check[6] = {0x00,0x00,0x00,0x00,0x00,0x00};
 
@@ -2279,7 +2953,6 @@ static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uin
     //    DataBufferSPI_RX_with_PEC[i]=0x00;
     }
 
-
     DataBufferSPI_TX_with_PEC[0] = Command[0];
     DataBufferSPI_TX_with_PEC[1] = Command[1];
     DataBufferSPI_TX_with_PEC[2] = Command[2];
@@ -2288,50 +2961,145 @@ static STD_RETURN_TYPE_e LTC_TX(uint8_t *Command, uint8_t *DataBufferSPI_TX, uin
     // Calculate PEC of all data (1 PEC value for 6 bytes)
     for(i=0;i<LTC_N_LTC;i++) {
 
-        PEC_Check[0]=DataBufferSPI_TX_with_PEC[4+i*8]=DataBufferSPI_TX[0+i*6];
-        PEC_Check[1]=DataBufferSPI_TX_with_PEC[5+i*8]=DataBufferSPI_TX[1+i*6];
-        PEC_Check[2]=DataBufferSPI_TX_with_PEC[6+i*8]=DataBufferSPI_TX[2+i*6];
-        PEC_Check[3]=DataBufferSPI_TX_with_PEC[7+i*8]=DataBufferSPI_TX[3+i*6];
-        PEC_Check[4]=DataBufferSPI_TX_with_PEC[8+i*8]=DataBufferSPI_TX[4+i*6];
-        PEC_Check[5]=DataBufferSPI_TX_with_PEC[9+i*8]=DataBufferSPI_TX[5+i*6];
+        PEC_Check[0]=DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+0]=DataBufferSPI_TX[0+i*6];
+        PEC_Check[1]=DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+1]=DataBufferSPI_TX[1+i*6];
+        PEC_Check[2]=DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+2]=DataBufferSPI_TX[2+i*6];
+        PEC_Check[3]=DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+3]=DataBufferSPI_TX[3+i*6];
+        PEC_Check[4]=DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+4]=DataBufferSPI_TX[4+i*6];
+        PEC_Check[5]=DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+5]=DataBufferSPI_TX[5+i*6];
 
         PEC_result=LTC_pec15_calc(6, PEC_Check);
-        DataBufferSPI_TX_with_PEC[10+i*8]=(uint8_t)((PEC_result>>8)&0xff);
-        DataBufferSPI_TX_with_PEC[11+i*8]=(uint8_t)(PEC_result&0xff);
+        DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+6]=(uint8_t)((PEC_result>>8)&0xff);
+        DataBufferSPI_TX_with_PEC[LTC_DATA_OFFSET(i)+7]=(uint8_t)(PEC_result&0xff);
 
     }
 
-    statusSPI = LTC_SendData(DataBufferSPI_TX_with_PEC);
-
-    if(statusSPI != E_OK) {
+}
 
-        return E_NOT_OK;
-    }
-    else
-        return E_OK;
+/**
+ * @brief   sends a dummy byte to wake up the daisy-chain.
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_SendWakeUp(void) {
 
+#if LTC_KEEPALIVE == TRUE
+    LTC_KEEPALIVE_FrameQueued(FALSE);
+#endif
+    return LTC_Transmit((uint8_t *) ltc_cmdDummy, 1);
 }
 
+
 /**
- * @brief   configures the data that will be sent to the LTC daisy-chain to configure multiplexer channels.
- *
- * This function does not sent the data to the multiplexer daisy-chain. This is done
- * by the function LTC_SetMuxChannel(), which calls LTC_SetMUXChCommand().
+ * @brief   queues a frame to be transmitted to the daisy-chain.
  *
- * @param   *DataBufferSPI_TX      data to be sent to the daisy-chain to configure the multiplexer channels
- * @param   mux                    multiplexer ID to be configured (0,1,2 or 3)
- * @param   channel                multiplexer channel to be configured (0 to 7)
+ * With LTC_KEEPALIVE, a wake-up frame is queued first if the isoSPI ports of the daisy-chain may be idle.
  *
- * @return  void
+ * @param   *txbuf      data to be sent
+ * @param   size        number of bytes to be sent
  *
+ * @return  E_OK if the frame was queued, E_NOT_OK otherwise
  */
-static void LTC_SetMUXChCommand(uint8_t *DataBufferSPI_TX, uint8_t mux, uint8_t channel) {
+static STD_RETURN_TYPE_e LTC_QueueFrame(uint8_t *txbuf, uint16_t size) {
 
-    uint16_t i = 0;
+#if LTC_KEEPALIVE == TRUE
+    (void)LTC_KEEPALIVE_WakeUp();
+    LTC_KEEPALIVE_FrameQueued(TRUE);
+#endif
+    return LTC_Transmit(txbuf, size);
+}
 
-    for(i = 0; i < LTC_N_LTC; i++) {
 
-#if SLAVE_BOARD_VERSION == 2
+/**
+ * @brief   sends a command followed by the clock cycles of an I2C transmission.
+ *
+ * @param   *txbuf      command, PEC and dummy bytes
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_SendI2CCmd(uint8_t *txbuf) {
+    return LTC_QueueFrame(txbuf, 4+9);
+}
+
+
+/**
+ * @brief   sends a command with data.
+ *
+ * @param   *txbuf      frame with command, data and PECs, LTC_N_BYTES_FOR_DATA_TRANSMISSION bytes
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_SendData(uint8_t *txbuf) {
+    return LTC_QueueFrame(txbuf, LTC_N_BYTES_FOR_DATA_TRANSMISSION);
+}
+
+
+/**
+ * @brief   sends a command without data.
+ *
+ * @param   *command    command and PEC
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_SendCmd(const uint8_t *command) {
+    return LTC_QueueFrame((uint8_t *) command, 4);
+}
+
+
+/**
+ * @brief   sends a read command and receives the answer of the daisy-chain.
+ *
+ * The ID of the frame is stored in ltc_state.rxFrameID. A frame queued after a PEC error
+ * (ltc_state.ErrPECCounter > 0) is a retry of the LTCs flagged in LTC_ErrorTable.
+ *
+ * @param   *txbuf      command, PEC and dummy bytes
+ * @param   *rxbuf      receive buffer, LTC_N_BYTES_FOR_DATA_TRANSMISSION bytes
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_ReceiveData(uint8_t *txbuf, uint8_t *rxbuf) {
+
+#if LTC_COMM_HEALTH == TRUE
+    uint16_t i = 0;
+
+    if(ltc_state.ErrPECCounter > 0) {
+        // the frame is read again because of the PEC errors of the LTCs flagged in LTC_ErrorTable
+        for(i=0;i<LTC_N_LTC;i++) {
+            if(LTC_ErrorTable[i/LTC_NUMBER_OF_LTC_PER_MODULE].LTC[i%LTC_NUMBER_OF_LTC_PER_MODULE] != 0) {
+                LTC_HEALTH_CountRetry(i);
+            }
+        }
+    }
+#endif
+#if LTC_KEEPALIVE == TRUE
+    (void)LTC_KEEPALIVE_WakeUp();
+    LTC_KEEPALIVE_FrameQueued(TRUE);
+#endif
+    return LTC_TransmitReceive(txbuf, rxbuf, &ltc_state.rxFrameID);
+}
+
+
+
+/**
+ * @brief   configures the data that will be sent to the LTC daisy-chain to configure multiplexer channels.
+ *
+ * This function does not sent the data to the multiplexer daisy-chain. This is done
+ * by the function LTC_SetMuxChannel(), which calls LTC_SetMUXChCommand().
+ *
+ * @param   *DataBufferSPI_TX      data to be sent to the daisy-chain to configure the multiplexer channels
+ * @param   mux                    multiplexer ID to be configured (0,1,2 or 3)
+ * @param   channel                multiplexer channel to be configured (0 to 7)
+ *
+ * @return  void
+ *
+ */
+static void LTC_SetMUXChCommand(uint8_t *DataBufferSPI_TX, uint8_t mux, uint8_t channel) {
+
+    uint16_t i = 0;
+
+    for(i = 0; i < LTC_N_LTC; i++) {
+
+#if SLAVE_BOARD_VERSION == 2
 
         /* using ADG728 */
 
@@ -2385,9 +3153,21 @@ static uint8_t LTC_SetMuxChannel(uint8_t *DataBufferSPI_TX, uint8_t *DataBufferS
 
     STD_RETURN_TYPE_e statusSPI = E_NOT_OK;
 
-    //send WRCOMM to send I2C message to choose channel
-    LTC_SetMUXChCommand(DataBufferSPI_TX,mux,channel);
-    statusSPI = LTC_TX((uint8_t*)ltc_cmdWRCOMM, DataBufferSPI_TX, DataBufferSPI_TX_with_PEC);
+#if LTC_MUX_FRAME_CACHE == TRUE
+    if((mux < LTC_N_MUX_PER_LTC) && ((channel < LTC_N_MUX_CHANNELS_PER_MUX) || (channel == 0xFF))) {
+        // frame was built in LTC_BuildMuxFrameCache(), send it as it is
+        if(channel == 0xFF) {
+            channel = LTC_N_MUX_CHANNELS_PER_MUX;
+        }
+        statusSPI = LTC_SendData(ltc_mux_frame_cache[mux][channel]);
+    }
+    else
+#endif
+    {
+        //send WRCOMM to send I2C message to choose channel
+        LTC_SetMUXChCommand(DataBufferSPI_TX,mux,channel);
+        statusSPI = LTC_TX((uint8_t*)ltc_cmdWRCOMM, DataBufferSPI_TX, DataBufferSPI_TX_with_PEC);
+    }
 
     if(statusSPI != E_OK) {
 
@@ -2399,40 +3179,465 @@ static uint8_t LTC_SetMuxChannel(uint8_t *DataBufferSPI_TX, uint8_t *DataBufferS
 }
 
 
+#if LTC_MUX_FRAME_CACHE == TRUE
+/**
+ * @brief   builds the WRCOMM frames for all multiplexers and channels.
+ *
+ * The frames only depend on the multiplexer and the channel, so the PECs are calculated
+ * once at initialization and LTC_SetMuxChannel() sends the stored frame.
+ *
+ * @return  void
+ */
+static void LTC_BuildMuxFrameCache(void) {
+
+    uint8_t mux = 0;
+    uint8_t channel = 0;
+
+    for(mux=0;mux<LTC_N_MUX_PER_LTC;mux++) {
+        for(channel=0;channel<=LTC_N_MUX_CHANNELS_PER_MUX;channel++) {
+            // last entry: no channel selected
+            LTC_SetMUXChCommand(ltc_DataBufferSPI_TX_temperatures, mux, (channel < LTC_N_MUX_CHANNELS_PER_MUX) ? channel : 0xFF);
+            LTC_BuildTXFrame((uint8_t*)ltc_cmdWRCOMM, ltc_DataBufferSPI_TX_temperatures, ltc_mux_frame_cache[mux][channel]);
+        }
+    }
+}
+#endif
+
+
 /**
  * @brief   sends 72 clock pulses to the LTC daisy-chain.
  *
  * This function is used for the communication with the multiplexers via I2C on the GPIOs.
- * It send the command STCOMM to the LTC daisy-chain.
- *
- * @param   *DataBufferSPI_TX           data to be sent to the daisy-chain, set to 0xFF
- * @param   *DataBufferSPI_TX_with_PEC  data to be sent to the daisy-chain  with PEC (calculated by the function)
+ * It send the command STCOMM to the LTC daisy-chain. The frame is constant (ltc_frameSTCOMM).
  *
  * @return  statusSPI                   E_OK if clock pulses were sent correctly by SPI, E_NOT_OK otherwise
  *
  */
-static STD_RETURN_TYPE_e LTC_I2CClock(uint8_t *DataBufferSPI_TX, uint8_t *DataBufferSPI_TX_with_PEC) {
-
-    uint16_t i = 0;
+static STD_RETURN_TYPE_e LTC_I2CClock(void) {
 
     STD_RETURN_TYPE_e statusSPI = E_NOT_OK;
 
-    for(i=0;i<4+9;i++) {
-        DataBufferSPI_TX_with_PEC[i]=0xFF;
+    statusSPI = LTC_SendI2CCmd((uint8_t*)ltc_frameSTCOMM);
+
+    return statusSPI;
+}
+
+/**
+ * @brief   initializes a pipelined measurement.
+ *
+ * Resets the progress of the cell voltage readout and of the multiplexer step and
+ * starts a new timeline.
+ *
+ * @return  void
+ */
+static void LTC_PipelineInit(void) {
+
+    ltc_pipeline.cellConversionStarted = FALSE;
+    ltc_pipeline.cellConversionEnd = 0;
+    ltc_pipeline.gpioConversionEnd = 0;
+    ltc_pipeline.voltageRegister = 0;
+    ltc_pipeline.nextMuxWritten = FALSE;
+    ltc_pipeline.pendingRX = LTC_PIPELINE_RX_NONE;
+
+    if((ltc_state.numberOfMeasuredMux == 0) || (ltc_state.muxmeas_seqptr >= ltc_state.muxmeas_seqendptr)) {
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_FINISHED;     // no multiplexer measurement requested or no sequence configured
+    }
+    else {
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_WRCOMM;
     }
 
-    DataBufferSPI_TX_with_PEC[0] = ltc_cmdSTCOMM[0];
-    DataBufferSPI_TX_with_PEC[1] = ltc_cmdSTCOMM[1];
-    DataBufferSPI_TX_with_PEC[2] = ltc_cmdSTCOMM[2];
-    DataBufferSPI_TX_with_PEC[3] = ltc_cmdSTCOMM[3];
+    ltc_pipeline.timeline.timestamp = MCU_GetTimeStamp();
+    ltc_pipeline.timeline.duration = 0;
+    ltc_pipeline.timeline.nr_of_entries = 0;
+}
+
 
-    statusSPI = LTC_SendI2CCmd(DataBufferSPI_TX_with_PEC);
+/**
+ * @brief   scheduler of the pipelined measurement.
+ *
+ * The LTC has one ADC, so the cell voltage conversion (ADCV) and the GPIO conversion (ADAX)
+ * are made one after another. The SPI transfers are scheduled around them:
+ *  - the multiplexer is switched (WRCOMM, STCOMM, RDCOMM) while the cell voltages are converted
+ *  - the cell voltage registers are read (RDCVA...D) while the multiplexer output is converted
+ *  - the COMM register is written with the next multiplexer step while the multiplexer output is converted
+ * The multiplexer is switched with one step: WRCOMM, STCOMM and RDCOMM are queued at once.
+ * At each call, the data received in the previous call is evaluated first. Then the next
+ * transfer whose preconditions are fulfilled is started, with the following priority:
+ * ADCV, RDAUXA, ADAX, WRCOMM/STCOMM/RDCOMM, RDCVx. If no transfer can be started, the
+ * scheduler waits for the end of the running conversion.
+ * The measurement is finished when all cell voltage registers were read and the multiplexer
+ * measurements of this cycle were made.
+ * If LTC_COMBINED_CONVERSION is TRUE, the multiplexer is switched first and its output is
+ * converted together with the cells (ADCVAX) instead of ADCV. ADAX is only used for further
+ * multiplexer measurements in the same cycle.
+ *
+ * @return  void
+ */
+static void LTC_PipelineSchedule(void) {
 
-    return statusSPI;
+    STD_RETURN_TYPE_e retVal = E_OK;
+    LTC_PIPELINE_RX_e pendingRX = LTC_PIPELINE_RX_NONE;
+    uint8_t accept = FALSE;
+    uint8_t mux_error = 0;
+    LTC_MUX_CH_CFG_s *muxstep = NULL_PTR;
+    uint32_t now = MCU_GetTimeStamp();
+    uint8_t cellConversionFinished = FALSE;
+    uint8_t gpioConversionFinished = FALSE;
+#if LTC_N_VOLTAGE_REGISTER_GROUPS > 4
+    static const uint8_t *ltc_cmdRDCV[LTC_N_VOLTAGE_REGISTER_GROUPS] = {ltc_cmdRDCVA, ltc_cmdRDCVB, ltc_cmdRDCVC, ltc_cmdRDCVD, ltc_cmdRDCVE, ltc_cmdRDCVF};
+#else
+    static const uint8_t *ltc_cmdRDCV[LTC_N_VOLTAGE_REGISTER_GROUPS] = {ltc_cmdRDCVA, ltc_cmdRDCVB, ltc_cmdRDCVC, ltc_cmdRDCVD};
+#endif
 
+    // evaluate the data received in the last step
+    pendingRX = ltc_pipeline.pendingRX;
+    ltc_pipeline.pendingRX = LTC_PIPELINE_RX_NONE;
 
+    if(pendingRX == LTC_PIPELINE_RX_RDCV) {
+        accept = TRUE;
+        if(LTC_DecodeVoltageRegister(ltc_pipeline.voltageRegister, ltc_DataBufferSPI_RX_with_PEC_voltages) != E_OK) {
+            if(LTC_PipelinePECError(&accept) != E_OK) {
+                return;
+            }
+            if((accept == FALSE) && (LTC_RetryVoltageRegister() == FALSE)) {
+                accept = TRUE;
+            }
+        }
+        if(accept == FALSE) {
+            return;     // the register group is read again after LTC_STATEMACH_PECERRTIME
+        }
+        LTC_ResetErrorTable();
+        ltc_state.ErrPECCounter = 0;
+        ++ltc_pipeline.voltageRegister;
+    }
+    else if(pendingRX == LTC_PIPELINE_RX_RDCOMM) {
+        accept = TRUE;
+        if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_temperatures) != E_OK) {
+            if(LTC_PipelinePECError(&accept) != E_OK) {
+                return;
+            }
+        }
+        if(accept == FALSE) {
+            return;     // RDCOMM is sent again after LTC_STATEMACH_PECERRTIME
+        }
+        LTC_ResetErrorTable();
+        ltc_state.ErrPECCounter = 0;
+        mux_error = LTC_I2CCheckACK(ltc_DataBufferSPI_RX_with_PEC_temperatures, ltc_state.muxmeas_groupptr->muxID, ltc_state.muxmeas_groupptr->muxCh);
+        if((mux_error != 0) && (LTC_DISCARD_MUX_CHECK == FALSE)) {
+            ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+            ltc_state.state = LTC_STATEMACH_ERROR_MUXFAILED;
+            ltc_state.substate = LTC_ERROR_ENTRY;
+            return;
+        }
+        LTC_PipelineMuxChannelSet();
+    }
+    else if(pendingRX == LTC_PIPELINE_RX_RDAUXA) {
+        accept = TRUE;
+        if(LTC_RX_PECCheck(ltc_DataBufferSPI_RX_with_PEC_temperatures) != E_OK) {
+            if(LTC_PipelinePECError(&accept) != E_OK) {
+                return;
+            }
+        }
+        else {
+            ltc_state.ErrPECCounter = 0;
+        }
+        LTC_ResetErrorTable();
+        if(accept == TRUE) {
+            for(muxstep=ltc_state.muxmeas_seqptr;muxstep<ltc_state.muxmeas_groupendptr;muxstep++) {
+                LTC_SaveMuxMeasurement(ltc_DataBufferSPI_RX_with_PEC_temperatures, muxstep, TRUE);
+            }
+        }
+        // as in the sequential measurement, the measurement is not repeated and a frame with PEC errors is not reported to the multiplexer schedule
+        LTC_PipelineNextMuxStep(TRUE);
+        if(accept == FALSE) {
+            return;     // the next transfer is started after LTC_STATEMACH_PECERRTIME
+        }
+    }
+
+    // measurement finished
+    if((ltc_pipeline.voltageRegister >= LTC_N_VOLTAGE_REGISTER_GROUPS) && (ltc_pipeline.muxStep == LTC_PIPELINE_MUX_FINISHED)) {
+        ltc_pipeline.timeline.duration = (uint16_t)(now - ltc_pipeline.timeline.timestamp);
+        taskENTER_CRITICAL();
+        ltc_pipeline_timeline = ltc_pipeline.timeline;
+        taskEXIT_CRITICAL();
+
+        ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+        ltc_state.ErrRetryCounter = 0;
+        LTC_SAVELASTSTATES();
+        ltc_state.substate = LTC_ENTRY;
+        ltc_state.state = LTC_STATEMACH_IDLE;
+        return;
+    }
+
+    if(ltc_pipeline.cellConversionStarted == TRUE) {
+        cellConversionFinished = ((int32_t)(now - ltc_pipeline.cellConversionEnd) >= 0) ? TRUE : FALSE;
+    }
+    if(ltc_pipeline.muxStep == LTC_PIPELINE_MUX_CONVERSION) {
+        gpioConversionFinished = ((int32_t)(now - ltc_pipeline.gpioConversionEnd) >= 0) ? TRUE : FALSE;
+    }
+
+    // start the next transfer
+#if LTC_COMBINED_CONVERSION == TRUE
+    if((ltc_pipeline.cellConversionStarted == FALSE) && (ltc_pipeline.muxStep == LTC_PIPELINE_MUX_READY) &&
+       ((ltc_state.muxmeas_gpiomask & ~0x03) == 0)) {
+        // the multiplexers are switched, their outputs (GPIO1/2) are converted together with the cells
+        retVal = LTC_StartCombinedMeasurement(ltc_state.adcMode);
+        if(retVal == E_OK) {
+            ltc_cellvoltage.previous_timestamp = ltc_cellvoltage.timestamp;
+            ltc_cellvoltage.timestamp = now;
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+            LTC_SYNC_ConversionStarted(MCU_GetTime_us() + ltc_state.commandTransferTime_us, ltc_state.adcMode);
+#endif
+            ltc_pipeline.cellConversionStarted = TRUE;
+            ltc_pipeline.cellConversionEnd = now + ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, LTC_ADCMEAS_COMBINED);
+            ltc_pipeline.gpioConversionEnd = ltc_pipeline.cellConversionEnd;
+            ltc_pipeline.muxStep = LTC_PIPELINE_MUX_CONVERSION;
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_COMBINED_CONVERSION, now, ltc_pipeline.cellConversionEnd);
+            ltc_state.timer = ltc_state.commandTransferTime;
+        }
+    }
+    else if((ltc_pipeline.cellConversionStarted == FALSE) &&
+            ((ltc_pipeline.muxStep == LTC_PIPELINE_MUX_FINISHED) || (ltc_pipeline.muxStep == LTC_PIPELINE_MUX_READY))) {
+#else
+    if(ltc_pipeline.cellConversionStarted == FALSE) {
+#endif
+        retVal = LTC_StartVoltageMeasurement(ltc_state.adcMode, ltc_state.adcMeasCh);
+        if(retVal == E_OK) {
+            ltc_cellvoltage.previous_timestamp = ltc_cellvoltage.timestamp;
+            ltc_cellvoltage.timestamp = now;
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+            LTC_SYNC_ConversionStarted(MCU_GetTime_us() + ltc_state.commandTransferTime_us, ltc_state.adcMode);
+#endif
+            ltc_pipeline.cellConversionStarted = TRUE;
+            ltc_pipeline.cellConversionEnd = now + ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(ltc_state.adcMode, ltc_state.adcMeasCh);
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_CELL_CONVERSION, now, ltc_pipeline.cellConversionEnd);
+            ltc_state.timer = ltc_state.commandTransferTime;
+        }
+    }
+    else if(gpioConversionFinished == TRUE) {
+        retVal = LTC_RX((uint8_t*)ltc_cmdRDAUXA, ltc_DataBufferSPI_RX_with_PEC_temperatures);
+        if(retVal == E_OK) {
+            ltc_pipeline.pendingRX = LTC_PIPELINE_RX_RDAUXA;
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_READ_GPIO, now, now + ltc_state.commandDataTransferTime);
+            ltc_state.timer = ltc_state.commandDataTransferTime;
+        }
+    }
+    else if((ltc_pipeline.muxStep == LTC_PIPELINE_MUX_READY) && (cellConversionFinished == TRUE)) {
+        retVal = LTC_StartGPIOMeasurement(LTC_GPIO_MEASUREMENT_MODE, LTC_GetMuxGroupMeasCh());
+        if(retVal == E_OK) {
+            ltc_pipeline.muxStep = LTC_PIPELINE_MUX_CONVERSION;
+            ltc_pipeline.gpioConversionEnd = now + ltc_state.commandTransferTime + LTC_Get_MeasurementTCycle(LTC_GPIO_MEASUREMENT_MODE, LTC_GetMuxGroupMeasCh());
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_GPIO_CONVERSION, now, ltc_pipeline.gpioConversionEnd);
+            ltc_state.timer = ltc_state.commandTransferTime;
+        }
+    }
+    else if((ltc_pipeline.muxStep == LTC_PIPELINE_MUX_CONVERSION) && (ltc_pipeline.nextMuxWritten == FALSE) &&
+            (ltc_state.numberOfMeasuredMux > 1) && (ltc_state.muxmeas_groupendptr < ltc_state.muxmeas_seqendptr)) {
+        // only the COMM register is written, the multiplexer is switched with STCOMM after the conversion
+        retVal = LTC_SetMuxChannel(ltc_DataBufferSPI_TX_temperatures, ltc_DataBufferSPI_TX_with_PEC_temperatures,
+                                   ltc_state.muxmeas_groupendptr->muxID, ltc_state.muxmeas_groupendptr->muxCh);
+        if(retVal == E_OK) {
+            ltc_pipeline.nextMuxWritten = TRUE;
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_MUX_SETUP, now, now + ltc_state.commandDataTransferTime);
+            ltc_state.timer = ltc_state.commandDataTransferTime;
+        }
+    }
+    else if((ltc_pipeline.muxStep == LTC_PIPELINE_MUX_WRCOMM) || (ltc_pipeline.muxStep == LTC_PIPELINE_MUX_STCOMM)) {
+        // WRCOMM, STCOMM and RDCOMM are queued at once and transferred back to back
+        if(ltc_pipeline.muxStep == LTC_PIPELINE_MUX_WRCOMM) {
+            retVal = LTC_SetMuxChannel(ltc_DataBufferSPI_TX_temperatures, ltc_DataBufferSPI_TX_with_PEC_temperatures,
+                                       ltc_state.muxmeas_groupptr->muxID, ltc_state.muxmeas_groupptr->muxCh);
+        }
+        if(retVal == E_OK) {
+            retVal = LTC_I2CClock();
+        }
+        if((retVal == E_OK) && (LTC_READCOM == 1)) {
+            retVal = LTC_RX((uint8_t*)ltc_cmdRDCOMM, ltc_DataBufferSPI_RX_with_PEC_temperatures);
+        }
+        if(retVal == E_OK) {
+            if(LTC_READCOM == 1) {
+                ltc_pipeline.muxStep = LTC_PIPELINE_MUX_RDCOMM;
+                ltc_pipeline.pendingRX = LTC_PIPELINE_RX_RDCOMM;
+            }
+            else {
+                LTC_PipelineMuxChannelSet();
+            }
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_MUX_SETUP, now, now + ltc_state.muxSetupTransferTime);
+            ltc_state.timer = ltc_state.muxSetupTransferTime;
+        }
+    }
+    else if(ltc_pipeline.muxStep == LTC_PIPELINE_MUX_RDCOMM) {
+        // RDCOMM is sent again after a PEC error
+        retVal = LTC_RX((uint8_t*)ltc_cmdRDCOMM, ltc_DataBufferSPI_RX_with_PEC_temperatures);
+        if(retVal == E_OK) {
+            ltc_pipeline.pendingRX = LTC_PIPELINE_RX_RDCOMM;
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_MUX_SETUP, now, now + ltc_state.commandDataTransferTime);
+            ltc_state.timer = ltc_state.commandDataTransferTime;
+        }
+    }
+    else if((cellConversionFinished == TRUE) && (ltc_pipeline.voltageRegister < LTC_N_VOLTAGE_REGISTER_GROUPS)) {
+        retVal = LTC_RX((uint8_t*)ltc_cmdRDCV[ltc_pipeline.voltageRegister], ltc_DataBufferSPI_RX_with_PEC_voltages);
+        if(retVal == E_OK) {
+            ltc_pipeline.pendingRX = LTC_PIPELINE_RX_RDCV;
+            LTC_PipelineTimelineAdd(LTC_PIPELINE_READ_VOLTAGE, now, now + ltc_state.commandDataTransferTime);
+            ltc_state.timer = ltc_state.commandDataTransferTime;
+        }
+    }
+    else {
+        // wait for the end of the running conversion
+        ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+    }
+
+    if(retVal != E_OK) {
+        LTC_PipelineTransferError();
+    }
+    else {
+        ltc_state.ErrRetryCounter = 0;
+    }
+}
+
+
+/**
+ * @brief   goes further with the next step of the multiplexer sequence in the pipelined measurement.
+ *
+ * The steps of the finished multiplexer group are skipped.
+ * When the end of the sequence is reached, the sequence starts again and ltc_muxcycle_finished is set.
+ *
+ * @param   measured    TRUE if multiplexer inputs were measured in the finished step, FALSE if the multiplexers were switched off
+ *
+ * @return  void
+ */
+static void LTC_PipelineNextMuxStep(uint8_t measured) {
+
+    ltc_state.muxmeas_seqptr = ltc_state.muxmeas_groupendptr;
+    LTC_StartMuxGroup();
+    if(measured == TRUE) {
+        --ltc_state.numberOfMeasuredMux;
+    }
+
+    if(ltc_state.muxmeas_seqptr >= ltc_state.muxmeas_seqendptr) {
+        // last step of sequence reached, the mux sequence starts again
+        ltc_muxcycle_finished = E_OK;
+        LTC_RestartMuxSequence();
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_FINISHED;
+    }
+    else if(ltc_state.numberOfMeasuredMux == 0) {
+        // number of multiplexers reached for this cycle, but multiplexer sequence not finished yet
+        ltc_muxcycle_finished = E_NOT_OK;
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_FINISHED;
+    }
+    else if(ltc_pipeline.nextMuxWritten == TRUE) {
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_STCOMM;
+    }
+    else {
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_WRCOMM;
+    }
+    ltc_pipeline.nextMuxWritten = FALSE;
 }
 
+
+/**
+ * @brief   goes further after the channel of a multiplexer was set in the pipelined measurement.
+ *
+ * The next multiplexer of the group is set, or the GPIO conversion of the group can start.
+ * Groups that only switch multiplexers off are finished without a conversion.
+ *
+ * @return  void
+ */
+static void LTC_PipelineMuxChannelSet(void) {
+
+    if((ltc_state.muxmeas_groupptr+1) < ltc_state.muxmeas_groupendptr) {
+        ++ltc_state.muxmeas_groupptr;
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_WRCOMM;
+    }
+    else if(ltc_state.muxmeas_gpiomask == 0) {
+        // multiplexers switched off, this does not count as a measurement
+        LTC_PipelineNextMuxStep(FALSE);
+    }
+    else {
+        ltc_pipeline.muxStep = LTC_PIPELINE_MUX_READY;
+    }
+}
+
+
+/**
+ * @brief   records a phase in the timeline of the running pipelined measurement.
+ *
+ * @param   phase   phase that was started
+ * @param   start   time stamp of the start of the phase
+ * @param   end     time stamp of the end of the phase
+ *
+ * @return  void
+ */
+static void LTC_PipelineTimelineAdd(LTC_PIPELINE_PHASE_e phase, uint32_t start, uint32_t end) {
+
+    LTC_PIPELINE_TIMELINE_ENTRY_s *entry = NULL_PTR;
+
+    if(ltc_pipeline.timeline.nr_of_entries < LTC_PIPELINE_TIMELINE_LENGTH) {
+        entry = &ltc_pipeline.timeline.entry[ltc_pipeline.timeline.nr_of_entries];
+        entry->phase = phase;
+        entry->start = (uint16_t)(start - ltc_pipeline.timeline.timestamp);
+        entry->end = (uint16_t)(end - ltc_pipeline.timeline.timestamp);
+        ++ltc_pipeline.timeline.nr_of_entries;
+    }
+}
+
+
+/**
+ * @brief   handles a failed SPI transfer in the pipelined measurement.
+ *
+ * The transfer is retried after LTC_STATEMACH_SEQERRTTIME. After LTC_TRANSMIT_SPIERRLIMIT
+ * retries, the state machine goes to the SPI error state.
+ *
+ * @return  void
+ */
+static void LTC_PipelineTransferError(void) {
+
+    ++ltc_state.ErrRetryCounter;
+    ltc_state.timer = LTC_STATEMACH_SEQERRTTIME;
+    if (ltc_state.ErrRetryCounter>LTC_TRANSMIT_SPIERRLIMIT)
+    {
+        ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+        ltc_state.state = LTC_STATEMACH_ERROR_SPIFAILED;
+        ltc_state.substate = LTC_ERROR_ENTRY;
+    }
+}
+
+
+/**
+ * @brief   handles a PEC error in the pipelined measurement.
+ *
+ * Up to LTC_TRANSMIT_PECERRLIMIT errors, the data is not accepted and the transfer is repeated.
+ * Then the data is accepted if LTC_DISCARD_PEC_CHECK is TRUE, otherwise the state machine
+ * goes to the PEC error state.
+ *
+ * @param   accept  set to TRUE if the data can be used despite of the PEC error, FALSE if the transfer has to be repeated
+ *
+ * @return  E_NOT_OK if the state machine went to the error state, E_OK otherwise
+ */
+static STD_RETURN_TYPE_e LTC_PipelinePECError(uint8_t *accept) {
+
+    *accept = FALSE;
+    if(++ltc_state.ErrPECCounter>LTC_TRANSMIT_PECERRLIMIT)
+    {
+        if (LTC_DISCARD_PEC_CHECK == FALSE)
+        {
+            ltc_state.timer = LTC_STATEMACH_SHORTTIME;
+            ltc_state.state = LTC_STATEMACH_ERROR_PECFAILED;
+            ltc_state.substate = LTC_ERROR_ENTRY;
+            return E_NOT_OK;
+        }
+        *accept = TRUE;
+    }
+    else
+    {
+        ltc_state.timer = LTC_STATEMACH_PECERRTIME;
+    }
+    return E_OK;
+}
+
+
+
 LTC_RETURN_TYPE_e LTC_Ctrl(LTC_TASK_TYPE_e LTC_Todo)
 {
     LTC_STATEMACH_e ltcstate = LTC_STATEMACH_UNDEFINED;
@@ -2440,6 +3645,34 @@ LTC_RETURN_TYPE_e LTC_Ctrl(LTC_TASK_TYPE_e LTC_Todo)
 
     ltc_task_1ms_cnt++;
 
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+    LTC_SYNC_Trigger();
+#endif
+
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+    if(LTC_SPICLK_Apply() == TRUE) {
+        LTC_SetTransferTimes();
+    }
+#endif
+
+#if LTC_KEEPALIVE == TRUE
+    if((ltc_state.state >= LTC_STATEMACH_INITIALIZED) && (ltc_state.state < LTC_STATEMACH_UNDEFINED)) {
+        LTC_KEEPALIVE_Trigger();
+    }
+#endif
+
+#if LTC_COMM_HEALTH == TRUE
+    LTC_HEALTH_Trigger();
+#endif
+
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+    LTC_TIMING_Trigger();
+#endif
+
+#if LTC_BURST_CAPTURE == TRUE
+    LTC_BURST_Trigger();
+#endif
+
     if(LTC_GetStateRequest() == LTC_STATE_NO_REQUEST)
     {
         ltcstate = LTC_GetState();
@@ -2458,9 +3691,66 @@ LTC_RETURN_TYPE_e LTC_Ctrl(LTC_TASK_TYPE_e LTC_Todo)
 
                 ++ltc_taskcycle;
 
+#if LTC_BURST_CAPTURE == TRUE
+                if((ltc_taskcycle < LTC_BURST_TASKCYCLE) && (LTC_BURST_Start(ltc_cellvoltage.voltage, ltc_cellvoltage.timestamp) == TRUE))
+                {
+                    ltc_taskcycle = LTC_BURST_TASKCYCLE;
+                }
+#endif
+
                 switch(ltc_taskcycle)
                 {
+#if LTC_BURST_CAPTURE == TRUE
+                case LTC_BURST_TASKCYCLE:
+                    // pipelined measurement without multiplexer steps: the registers are read as soon as the conversion is finished
+                    retVal = LTC_SetStateRequest(LTC_STATE_PIPELINEDMEASUREMENT_REQUEST,LTC_BURST_MEASUREMENT_MODE,LTC_ADCMEAS_ALLCHANNEL, 0);
+                    break;
+
+                case LTC_BURST_TASKCYCLE+1:
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+                    LTC_SYNC_VoltagesRead(&ltc_cellvoltage);
+#endif
+                    if(LTC_BURST_SaveSample(ltc_cellvoltage.voltage, ltc_cellvoltage.timestamp) == TRUE)
+                    {
+                        ltc_taskcycle = LTC_BURST_TASKCYCLE;
+                        retVal = LTC_SetStateRequest(LTC_STATE_PIPELINEDMEASUREMENT_REQUEST,LTC_BURST_MEASUREMENT_MODE,LTC_ADCMEAS_ALLCHANNEL, 0);
+                    }
+                    else
+                    {
+                        LTC_SaveVoltages();
+                        ltc_taskcycle=1;        // Resume the normal measurement cycle
+                    }
+                    break;
+#endif
 
+#if LTC_PIPELINED_MEASUREMENT == TRUE
+                case 2:
+                    retVal = LTC_SetStateRequest(LTC_STATE_PIPELINEDMEASUREMENT_REQUEST,LTC_VOLTAGE_MEASUREMENT_MODE,LTC_ADCMEAS_ALLCHANNEL, LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE);
+                    break;
+
+                case 3:
+                    LTC_SaveVoltages();
+                    if (ltc_muxcycle_finished==E_OK){
+                        LTC_SaveTemperatures_SaveBalancingFeedback();
+                        retVal = LTC_SetStateRequest(LTC_STATE_BALANCECONTROL_REQUEST,LTC_ADCMODE_NORMAL_DCP0,LTC_ADCMEAS_ALLCHANNEL, LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE);
+                    }
+                    break;
+
+                case 4:
+                    retVal = LTC_SetStateRequest(LTC_STATE_ALLGPIOMEASUREMENT_REQUEST,LTC_ADCMODE_NORMAL_DCP0,LTC_ADCMEAS_ALLCHANNEL, LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE);
+                    break;
+
+                case 5:
+                    LTC_SaveAllGPIOs();
+#if LTC_SIMULATION == TRUE
+                    LTC_SIM_BenchmarkCycleFinished();
+#endif
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+                    LTC_TIMING_CycleFinished();
+#endif
+                    ltc_taskcycle=1;            // Restart measurement cycle
+                    break;
+#else
                 case 2:
                     retVal = LTC_SetStateRequest(LTC_STATE_VOLTAGEMEASUREMENT_REQUEST,LTC_VOLTAGE_MEASUREMENT_MODE,LTC_ADCMEAS_ALLCHANNEL, LTC_NUMBER_OF_MUX_MEASUREMENTS_PER_CYCLE);
                     break;
@@ -2488,9 +3778,15 @@ LTC_RETURN_TYPE_e LTC_Ctrl(LTC_TASK_TYPE_e LTC_Todo)
 
                 case 7:
                     LTC_SaveAllGPIOs();
+#if LTC_SIMULATION == TRUE
+                    LTC_SIM_BenchmarkCycleFinished();
+#endif
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+                    LTC_TIMING_CycleFinished();
+#endif
                     ltc_taskcycle=1;            // Restart measurement cycle
                     break;
-
+#endif
 
                 default:
                     ltc_taskcycle=1;
@@ -2527,31 +3823,7 @@ LTC_RETURN_TYPE_e LTC_Ctrl(LTC_TASK_TYPE_e LTC_Todo)
  */
 static uint32_t LTC_GetSPIClock(void) {
 
-    uint32_t SPI_Clock = 0;
-
-    if (LTC_SPI_INSTANCE == SPI2 || LTC_SPI_INSTANCE == SPI3) {
-        // SPI2 and SPI3 are connected to APB1 (PCLK1)
-        // The prescaler setup bits LTC_SPI_PRESCALER corresponds to the bits 5:3 in the SPI_CR1 register
-        // Reference manual p.909
-        // The shift by 3 puts the bits 5:3 to the first position
-        // Division are made by powers of 2 which corresponds to shifting to the right
-        // Then 0 corresponds to divide by 2, 1 corresponds to divide by 4... so 1 has to be added to the value of the configuration bits
-
-        SPI_Clock = HAL_RCC_GetPCLK1Freq()>>( (LTC_SPI_PRESCALER>>3)+1 );
-    }
-
-    if (LTC_SPI_INSTANCE == SPI1 || LTC_SPI_INSTANCE == SPI4 || LTC_SPI_INSTANCE == SPI5 || LTC_SPI_INSTANCE == SPI6) {
-        // SPI1, SPI4, SPI5 and SPI6 are connected to APB2 (PCLK2)
-        // The prescaler setup bits LTC_SPI_PRESCALER corresponds to the bits 5:3 in the SPI_CR1 register
-        // Reference manual p.909
-        // The shift by 3 puts the bits 5:3 to the first position
-        // Division are made by powers of 2 which corresponds to shifting to the right
-        // Then 0 corresponds to divide by 2, 1 corresponds to divide by 4... so 1 has to be added to the value of the configuration bits
-
-        SPI_Clock = HAL_RCC_GetPCLK2Freq()>>( (LTC_SPI_PRESCALER>>3)+1 );
-    }
-
-    return SPI_Clock;
+    return LTC_SPICLK_GetFrequency(LTC_SPI_HANDLE);
 }
 
 
@@ -2571,6 +3843,9 @@ static void LTC_SetTransferTimes(void) {
     uint32_t SPI_Clock = 0;
 
     SPI_Clock = LTC_GetSPIClock();
+#if LTC_KEEPALIVE == TRUE
+    LTC_KEEPALIVE_SetSPIClock(SPI_Clock);
+#endif
 
     // Transmission of a command and data
     // Multiplication by 1000*1000 to get us
@@ -2583,12 +3858,19 @@ static void LTC_SetTransferTimes(void) {
     transferTime_us = ((4)*8*1000*1000)/(SPI_Clock);
     transferTime_us = transferTime_us + SPI_WAKEUP_WAIT_TIME;
     ltc_state.commandTransferTime = (transferTime_us/1000)+1;
+    ltc_state.commandTransferTime_us = transferTime_us;
 
     // Transmission of a command + 9 clocks
     // Multiplication by 1000*1000 to get us
     transferTime_us = ((4+9)*8*1000*1000)/(SPI_Clock);
     transferTime_us = transferTime_us + SPI_WAKEUP_WAIT_TIME;
     ltc_state.gpioClocksTransferTime = (transferTime_us/1000)+1;
+
+    // Transmission of WRCOMM, STCOMM and RDCOMM queued one after another
+    // Multiplication by 1000*1000 to get us
+    transferTime_us = ((LTC_N_BYTES_FOR_DATA_TRANSMISSION*(1+LTC_READCOM)+4+9)*8*1000*1000)/(SPI_Clock);
+    transferTime_us = transferTime_us + (1+1+LTC_READCOM)*SPI_WAKEUP_WAIT_TIME;
+    ltc_state.muxSetupTransferTime = (transferTime_us/1000)+1;
 }
 
 
@@ -2642,7 +3924,8 @@ static LTC_RETURN_TYPE_e LTC_CheckStateRequest(LTC_STATE_REQUEST_e statereq) {
             (statereq == LTC_STATE_MUXMEASUREMENT_REQUEST) ||
             (statereq == LTC_STATE_BALANCECONTROL_REQUEST) ||
             (statereq == LTC_STATE_IDLE_REQUEST) ||
-            (statereq == LTC_STATE_ALLGPIOMEASUREMENT_REQUEST)
+            (statereq == LTC_STATE_ALLGPIOMEASUREMENT_REQUEST) ||
+            (statereq == LTC_STATE_PIPELINEDMEASUREMENT_REQUEST)
           ) {
 
             if (ltc_state.state==LTC_STATEMACH_IDLE) {
@@ -75,6 +75,7 @@ typedef enum {
     LTC_ADCMEAS_UNDEFINED       = 0,    /*!< not defined                            */
     LTC_ADCMEAS_ALLCHANNEL      = 1,    /*!< all ADC channels are measured          */
     LTC_ADCMEAS_SINGLECHANNEL   = 2,    /*!< only a single ADC channel is measured  */
+    LTC_ADCMEAS_COMBINED        = 3,    /*!< all cells and GPIO1/2 (ADCVAX)         */
 } LTC_ADCMEAS_CHAN_e;
 
 /**
@@ -98,6 +99,7 @@ typedef enum {
     LTC_STATEMACH_BALANCECONTROL            = 14,   /*!<    */
     LTC_STATEMACH_ALLGPIOMEASUREMENT        = 15,   /*!<    */
     LTC_STATEMACH_READALLGPIO               = 16,   /*!<    */
+    LTC_STATEMACH_PIPELINEDMEASUREMENT      = 17,   /*!< overlapped voltage and multiplexer measurement */
     LTC_STATEMACH_UNDEFINED                 = 20,   /*!< undefined state                                */
     LTC_STATEMACH_RESERVED1                 = 0x80, /*!< reserved state                                 */
     LTC_STATEMACH_ERROR_SPIFAILED           = 0xF0, /*!< Error-State: SPI error                         */
@@ -149,6 +151,8 @@ typedef enum {
     LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE   = 2,    /*!<    */
     LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE   = 3,    /*!<    */
     LTC_EXIT_READVOLTAGE                            = 4,    /*!<    */
+    LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE   = 5,    /*!< only LTC6813   */
+    LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE   = 6,    /*!< only LTC6813   */
 } LTC_STATEMACH_READVOLTAGE_SUB_e;
 
 /**
@@ -158,6 +162,8 @@ typedef enum {
     // Init-Sequence
     LTC_ENTRY_BALANCECONTROL    = 0,    /*!<    */
     LTC_EXIT_BALANCECONTROL     = 1,    /*!<    */
+    LTC_READ_CFG_BALANCECONTROL = 2,    /*!< read back the configuration registers (RDCFG) */
+    LTC_CHECK_CFG_BALANCECONTROL = 3,   /*!< compare the configuration registers with the written ones */
 } LTC_STATEMACH_BALANCECONTROL_SUB;
 
 /**
@@ -190,6 +196,81 @@ typedef enum {
     LTC_SAVE_MUX_MEASUREMENT_MUXMEASUREMENT             = 1,    /*!<    */
 } LTC_STATEMACH_MUXMEASUREMENT_SUB_e;
 
+/**
+ * Substates for the pipelined measurement state
+ */
+typedef enum {
+    LTC_ENTRY_PIPELINEDMEASUREMENT      = 0,    /*!< start of a pipelined measurement   */
+    LTC_SCHEDULE_PIPELINEDMEASUREMENT   = 1,    /*!< scheduling of the next phase       */
+} LTC_STATEMACH_PIPELINEDMEASUREMENT_SUB_e;
+
+/**
+ * Phases of the pipelined measurement, as recorded in the timeline
+ */
+typedef enum {
+    LTC_PIPELINE_CELL_CONVERSION    = 0,    /*!< ADCV: conversion of all cell voltages                  */
+    LTC_PIPELINE_READ_VOLTAGE       = 1,    /*!< RDCVx: readout of one cell voltage register group      */
+    LTC_PIPELINE_MUX_SETUP          = 2,    /*!< WRCOMM, STCOMM or RDCOMM of a multiplexer step         */
+    LTC_PIPELINE_GPIO_CONVERSION    = 3,    /*!< ADAX: conversion of GPIO1 (multiplexer output)         */
+    LTC_PIPELINE_READ_GPIO          = 4,    /*!< RDAUXA: readout of the multiplexer measurement         */
+    LTC_PIPELINE_COMBINED_CONVERSION = 5,   /*!< ADCVAX: conversion of all cell voltages and GPIO1/2    */
+} LTC_PIPELINE_PHASE_e;
+
+/**
+ * Progress of the multiplexer step in the pipelined measurement
+ */
+typedef enum {
+    LTC_PIPELINE_MUX_WRCOMM         = 0,    /*!< multiplexer channel has to be written to the COMM register */
+    LTC_PIPELINE_MUX_STCOMM         = 1,    /*!< I2C transmission to the multiplexer has to be started      */
+    LTC_PIPELINE_MUX_RDCOMM         = 2,    /*!< result of the I2C transmission has to be read              */
+    LTC_PIPELINE_MUX_READY          = 3,    /*!< multiplexer switched, GPIO conversion can be started       */
+    LTC_PIPELINE_MUX_CONVERSION     = 4,    /*!< GPIO conversion running                                    */
+    LTC_PIPELINE_MUX_FINISHED       = 5,    /*!< all multiplexer measurements of this cycle made            */
+} LTC_PIPELINE_MUX_STEP_e;
+
+/**
+ * Data received in the pipelined measurement that still has to be evaluated
+ */
+typedef enum {
+    LTC_PIPELINE_RX_NONE            = 0,    /*!< nothing to evaluate                */
+    LTC_PIPELINE_RX_RDCV            = 1,    /*!< cell voltage register group        */
+    LTC_PIPELINE_RX_RDCOMM          = 2,    /*!< result of I2C transmission         */
+    LTC_PIPELINE_RX_RDAUXA          = 3,    /*!< multiplexer measurement            */
+} LTC_PIPELINE_RX_e;
+
+/**
+ * One phase in the timeline of a pipelined measurement
+ */
+typedef struct {
+    LTC_PIPELINE_PHASE_e phase;     /*!< phase of the measurement                                                   */
+    uint16_t start;                 /*!< start of the phase in ms, relative to the start of the measurement         */
+    uint16_t end;                   /*!< end of the phase (transfer or conversion finished) in ms, same reference   */
+} LTC_PIPELINE_TIMELINE_ENTRY_s;
+
+/**
+ * Timeline of a pipelined measurement, used to check how the phases overlap
+ */
+typedef struct {
+    uint32_t timestamp;                                             /*!< time stamp of the start of the measurement     */
+    uint16_t duration;                                              /*!< duration of the measurement in ms              */
+    uint8_t nr_of_entries;                                          /*!< number of recorded phases                      */
+    LTC_PIPELINE_TIMELINE_ENTRY_s entry[LTC_PIPELINE_TIMELINE_LENGTH];  /*!< recorded phases, in the order they started    */
+} LTC_PIPELINE_TIMELINE_s;
+
+/**
+ * State of the pipelined measurement
+ */
+typedef struct {
+    uint32_t cellConversionEnd;         /*!< time stamp at which the cell voltage conversion is finished            */
+    uint32_t gpioConversionEnd;         /*!< time stamp at which the GPIO conversion is finished                    */
+    uint8_t cellConversionStarted;      /*!< TRUE if ADCV was sent in this measurement                              */
+    uint8_t voltageRegister;            /*!< next cell voltage register group to read (0=A, 1=B...), LTC_N_VOLTAGE_REGISTER_GROUPS: all read */
+    LTC_PIPELINE_MUX_STEP_e muxStep;    /*!< progress of the current multiplexer step                               */
+    uint8_t nextMuxWritten;             /*!< TRUE if the COMM register already contains the next multiplexer step   */
+    LTC_PIPELINE_RX_e pendingRX;        /*!< data received in the last step that has to be evaluated                */
+    LTC_PIPELINE_TIMELINE_s timeline;   /*!< timeline of the running measurement                                    */
+} LTC_PIPELINE_s;
+
 /**
  * State requests for the LTC statemachine
  */
@@ -202,6 +283,7 @@ typedef enum {
     LTC_STATE_MUXMEASUREMENT_REQUEST      = LTC_STATEMACH_STARTMUXMEASUREMENT,      /*!<    */
     LTC_STATE_BALANCECONTROL_REQUEST      = LTC_STATEMACH_BALANCECONTROL,           /*!<    */
     LTC_STATE_ALLGPIOMEASUREMENT_REQUEST  = LTC_STATEMACH_ALLGPIOMEASUREMENT,       /*!<    */
+    LTC_STATE_PIPELINEDMEASUREMENT_REQUEST = LTC_STATEMACH_PIPELINEDMEASUREMENT,    /*!<    */
     LTC_STATE_NO_REQUEST                  = LTC_STATEMACH_RESERVED1,                /*!<    */
 } LTC_STATE_REQUEST_e;
 
@@ -265,12 +347,18 @@ typedef struct {
     uint8_t triggerentry;                   /*!< counter for re-entrance protection (function running flag) */
     uint32_t commandDataTransferTime;       /*!< time needed for sending an instruction to the LTC, followed by data transfer from the LTC   */
     uint32_t commandTransferTime;           /*!< time needed for sending an instruction to the LTC                                           */
+    uint32_t commandTransferTime_us;        /*!< time needed for sending an instruction to the LTC in us                                     */
     uint32_t gpioClocksTransferTime;        /*!< time needed for sending 72 clock signal to the LTC, used for I2C communication              */
+    uint32_t muxSetupTransferTime;          /*!< time needed for the queued frames WRCOMM, STCOMM (and RDCOMM) switching a multiplexer       */
+    uint8_t rxFrameID;                      /*!< ID of the last frame queued for receiving data (see SPI_GetFrameState())                   */
     uint32_t VoltageSampleTime;             /*!< time stamp at which the cell voltage were measured                                          */
     uint32_t muxSampleTime;                 /*!< time stamp at which a multiplexer input was measured                                        */
     LTC_MUX_CH_CFG_s *muxmeas_seqptr;       /*!< pointer to the multiplexer sequence to be measured (contains a list of elements [multiplexer id, multiplexer channels]) (1,-1)...(3,-1),(0,1),...(0,7)*/
     LTC_MUX_CH_CFG_s *muxmeas_seqendptr;    /*!< point to the end of the multiplexer sequence                                                   */     // pointer to ending point of sequence
     uint8_t muxmeas_nr_end;                 /*!< number of multiplexer channels that have to be measured^                                       */     // end number of sequence, where measurement is finished
+    LTC_MUX_CH_CFG_s *muxmeas_groupptr;     /*!< step of the current multiplexer group whose channel is set (see LTC_StartMuxGroup())          */
+    LTC_MUX_CH_CFG_s *muxmeas_groupendptr;  /*!< first step after the group of steps measured with one GPIO conversion                          */
+    uint8_t muxmeas_gpiomask;               /*!< GPIOs measured for the current multiplexer group (bit 0: GPIO1), 0: multiplexers switched off only */
 } LTC_STATE_s;
 
 /*================== Function Prototypes ==================================*/
@@ -315,6 +403,18 @@ extern LTC_RETURN_TYPE_e LTC_Ctrl(LTC_TASK_TYPE_e LTC_Todo);
  */
 extern LTC_RETURN_TYPE_e LTC_SetStateRequest(LTC_STATE_REQUEST_e statereq, LTC_ADCMODE_e adcModereq, LTC_ADCMEAS_CHAN_e adcMeasChreq, uint8_t numberOfMeasuredMux);
 
+/**
+ * @brief   gets the timeline of the last finished pipelined measurement.
+ *
+ * The timeline lists when each phase (conversions, transfers) of the measurement started
+ * and ended, so that the overlap of the phases can be checked.
+ *
+ * @param   timeline    pointer where the timeline is copied to
+ *
+ * @return  void
+ */
+extern void LTC_GetPipelineTimeline(LTC_PIPELINE_TIMELINE_s *timeline);
+
 /*================== Function Implementations =============================*/
 
 #endif /* LTC_H_ */
@@ -0,0 +1,232 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_burst.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_BURST
+ *
+ * @brief   Burst capture of the cell voltages.
+ *
+ * With LTC_BURST_CAPTURE set to TRUE, the LTC driver interrupts its normal measurement cycle
+ * when a capture is triggered and measures only the cell voltages with LTC_BURST_MEASUREMENT_MODE
+ * for LTC_BURST_WINDOW ms. The samples are stored in a ring buffer of LTC_BURST_SAMPLES entries
+ * together with the current of DATA_BLOCK_ID_CURRENT read when the sample is stored, the first entry
+ * is the last sample of the normal measurement before the trigger.
+ *
+ * A capture is triggered by incrementing request in DATA_BLOCK_ID_BURSTREQUEST or by a change of
+ * the current of more than LTC_BURST_CURRENT_STEP between two samples of DATA_BLOCK_ID_CURRENT.
+ * The trigger is evaluated at each call of LTC_Ctrl() and the capture starts the next time the driver
+ * is idle. After a capture, the current trigger is blocked for LTC_BURST_HOLDOFF ms. The state and the
+ * samples of the capture are stored in DATA_BLOCK_ID_BURSTCAPTURE, which is only written by this module.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_burst.h"
+
+#include "database.h"
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if LTC_BURST_CAPTURE == TRUE
+#if DATA_SEQLOCK_ACCESS != TRUE
+#error "LTC_BURST_CAPTURE needs DATA_SEQLOCK_ACCESS"
+#endif
+#if DATA_NR_OF_BURST_SAMPLES != LTC_BURST_SAMPLES
+#error "DATA_NR_OF_BURST_SAMPLES must be equal to LTC_BURST_SAMPLES"
+#endif
+#endif
+
+/*================== Constant and Variable Definitions ====================*/
+
+#if LTC_BURST_CAPTURE == TRUE
+static DATA_BLOCK_BURSTCAPTURE_s ltc_burst;
+static uint16_t ltc_burst_writeIndex = 0;       // index of the next sample in ltc_burst.sample
+static uint8_t ltc_burst_pending = FALSE;       // TRUE if a capture was triggered but not started yet
+static uint8_t ltc_burst_pendingRequest = 0;    // request which triggered the pending capture
+static float ltc_burst_pendingCurrent = 0.0;    // current which triggered the pending capture
+static uint32_t ltc_burst_currentTimestamp = 0; // timestamp of the last evaluated current sample
+static float ltc_burst_lastCurrent = 0.0;       // last evaluated current sample
+static uint32_t ltc_burst_end = 0;              // timestamp of the end of the last capture
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+#if LTC_BURST_CAPTURE == TRUE
+static void LTC_BURST_Store(uint16_t *voltage, uint32_t timestamp, float current);
+static void LTC_BURST_Publish(void);
+#endif
+
+/*================== Function Implementations =============================*/
+
+#if LTC_BURST_CAPTURE == TRUE
+
+void LTC_BURST_Trigger(void) {
+
+    DATA_BLOCK_CURRENT_s current;
+    DATA_BLOCK_BURSTREQUEST_s request;
+    float step = 0.0;
+
+    if ((ltc_burst.capturing == TRUE) || (ltc_burst_pending == TRUE)) {
+        return;
+    }
+
+    if (DATA_GetTable(&request, DATA_BLOCK_ID_BURSTREQUEST) == E_OK) {
+        if (request.request != ltc_burst.request_handled) {
+            ltc_burst_pending = TRUE;
+            ltc_burst_pendingRequest = request.request;
+        }
+    }
+
+    if ((DATA_GetTable(&current, DATA_BLOCK_ID_CURRENT) != E_OK) || (current.timestamp == ltc_burst_currentTimestamp)) {
+        // no new current sample to compare
+        return;
+    }
+
+#if LTC_BURST_CURRENT_STEP > 0
+    // no current measured before: there is no step to detect
+    if ((ltc_burst_currentTimestamp != 0) && ((MCU_GetTimeStamp() - ltc_burst_end) >= LTC_BURST_HOLDOFF)) {
+        step = current.current - ltc_burst_lastCurrent;
+        if (step < 0.0) {
+            step = -step;
+        }
+        if (step >= (float)LTC_BURST_CURRENT_STEP) {
+            if (ltc_burst_pending == FALSE) {
+                ltc_burst_pendingRequest = ltc_burst.request_handled;
+            }
+            ltc_burst_pending = TRUE;
+        }
+    }
+#endif
+    ltc_burst_pendingCurrent = current.current;
+    if (ltc_burst_pending == FALSE) {
+        // the reference of a pending capture is the current before the step
+        ltc_burst_lastCurrent = current.current;
+    }
+    ltc_burst_currentTimestamp = current.timestamp;
+}
+
+
+uint8_t LTC_BURST_Start(uint16_t *voltage, uint32_t timestamp) {
+
+    if (ltc_burst_pending == FALSE) {
+        return FALSE;
+    }
+
+    ltc_burst_pending = FALSE;
+    ltc_burst.request_handled = ltc_burst_pendingRequest;
+    ltc_burst.capturing = TRUE;
+    ltc_burst.nr_of_samples = 0;
+    ltc_burst.trigger_timestamp = MCU_GetTimeStamp();
+    ltc_burst.trigger_current = ltc_burst_pendingCurrent;
+    ltc_burst_writeIndex = 0;
+
+    // the voltages of the normal measurement were measured before the trigger
+    if (timestamp != 0) {
+        LTC_BURST_Store(voltage, timestamp, ltc_burst_lastCurrent);
+    }
+
+    LTC_BURST_Publish();
+
+    return TRUE;
+}
+
+
+uint8_t LTC_BURST_SaveSample(uint16_t *voltage, uint32_t timestamp) {
+
+    DATA_BLOCK_CURRENT_s current;
+
+    if (DATA_GetTable(&current, DATA_BLOCK_ID_CURRENT) != E_OK) {
+        current.current = ltc_burst_lastCurrent;
+        current.timestamp = ltc_burst_currentTimestamp;
+    }
+    LTC_BURST_Store(voltage, timestamp, current.current);
+
+    if ((timestamp - ltc_burst.trigger_timestamp) < LTC_BURST_WINDOW) {
+        return TRUE;
+    }
+
+    // a step during the capture must not trigger the next capture
+    ltc_burst_lastCurrent = current.current;
+    ltc_burst_currentTimestamp = current.timestamp;
+    ltc_burst_end = MCU_GetTimeStamp();
+    ltc_burst.capturing = FALSE;
+    ltc_burst.nr_of_captures++;
+    LTC_BURST_Publish();
+
+    return FALSE;
+}
+
+
+/**
+ * @brief   stores a sample in the ring buffer, the oldest sample is overwritten if it is full.
+ *
+ * @param   *voltage    cell voltages, unit: mV
+ * @param   timestamp   timestamp of the start of their conversion
+ * @param   current     current at the sample, unit: mA
+ *
+ * @return  void
+ */
+static void LTC_BURST_Store(uint16_t *voltage, uint32_t timestamp, float current) {
+
+    uint16_t i = 0;
+    DATA_BURST_SAMPLE_s *sample = &ltc_burst.sample[ltc_burst_writeIndex];
+
+    for (i = 0; i < BS_NR_OF_BAT_CELLS; i++) {
+        sample->voltage[i] = voltage[i];
+    }
+    sample->timestamp = timestamp;
+    sample->current = current;
+
+    ltc_burst_writeIndex = (ltc_burst_writeIndex + 1) % LTC_BURST_SAMPLES;
+    if (ltc_burst.nr_of_samples < LTC_BURST_SAMPLES) {
+        ltc_burst.nr_of_samples++;
+    }
+    ltc_burst.first_sample = (ltc_burst_writeIndex + LTC_BURST_SAMPLES - ltc_burst.nr_of_samples) % LTC_BURST_SAMPLES;
+}
+
+
+/**
+ * @brief   stores the state and the samples of the burst capture in DATA_BLOCK_ID_BURSTCAPTURE.
+ *
+ * @return  void
+ */
+static void LTC_BURST_Publish(void) {
+
+    ltc_burst.previous_timestamp = ltc_burst.timestamp;
+    ltc_burst.timestamp = MCU_GetTimeStamp();
+    DATA_StoreDataBlock(&ltc_burst, DATA_BLOCK_ID_BURSTCAPTURE);
+}
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_burst.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_BURST
+ *
+ * @brief   Headers for the burst capture of the cell voltages.
+ *
+ */
+
+#ifndef LTC_BURST_H_
+#define LTC_BURST_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   checks if a burst capture has to be triggered.
+ *
+ * Called by the LTC driver at each call of LTC_Ctrl(). A capture is triggered if it was requested
+ * in DATA_BLOCK_ID_BURSTREQUEST or if the current of DATA_BLOCK_ID_CURRENT changed by more than
+ * LTC_BURST_CURRENT_STEP between two samples. The triggered capture is started with LTC_BURST_Start().
+ *
+ * @return  void
+ */
+extern void LTC_BURST_Trigger(void);
+
+/**
+ * @brief   starts a triggered burst capture.
+ *
+ * Called by the LTC driver when it is idle. The last cell voltages of the normal measurement are
+ * stored as first sample of the capture, with the current before the trigger.
+ *
+ * @param   *voltage    last measured cell voltages, unit: mV
+ * @param   timestamp   timestamp of the start of their conversion
+ *
+ * @return  TRUE if a capture was started, FALSE if no capture was triggered
+ */
+extern uint8_t LTC_BURST_Start(uint16_t *voltage, uint32_t timestamp);
+
+/**
+ * @brief   stores a sample of the running burst capture.
+ *
+ * The current of the sample is read from the database when the sample is stored.
+ *
+ * @param   *voltage    measured cell voltages, unit: mV
+ * @param   timestamp   timestamp of the start of their conversion
+ *
+ * @return  TRUE if the capture continues, FALSE if LTC_BURST_WINDOW has elapsed
+ */
+extern uint8_t LTC_BURST_SaveSample(uint16_t *voltage, uint32_t timestamp);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_BURST_H_ */
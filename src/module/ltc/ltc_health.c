@@ -0,0 +1,196 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_health.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_HEALTH
+ *
+ * @brief   Communication health statistics of the LTC daisy-chain.
+ *
+ * LTC_ErrorTable only locates the LTCs and multiplexers of the last failed transfer. To find
+ * marginal isoSPI links, the following is counted for each LTC and never reset:
+ *
+ * - the PEC errors in a rolling window of LTC_HEALTH_WINDOW frames. The window consists of
+ *   LTC_HEALTH_NR_OF_BUCKETS buckets of LTC_HEALTH_BUCKET_FRAMES frames, the error rate is updated
+ *   each time a bucket is full and stored as errors per 1000 frames
+ * - the frames read again because of a PEC error of the LTC
+ * - the time of the last frame with correct PEC
+ * - the not acknowledged I2C transfers to each multiplexer channel of the module
+ *
+ * The statistics are stored in DATA_BLOCK_ID_LTC_COMMHEALTH every LTC_HEALTH_PERIOD_MS.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_health.h"
+
+#include "database.h"
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if LTC_COMM_HEALTH == TRUE
+#if DATA_NR_OF_LTC != LTC_N_LTC
+#error "DATA_NR_OF_LTC must be equal to LTC_N_LTC"
+#endif
+#if LTC_HEALTH_BUCKET_FRAMES > 255
+#error "LTC_HEALTH_BUCKET_FRAMES must fit in the 8 bit counters of a bucket"
+#endif
+#endif
+
+/**
+ * rolling PEC error window of an LTC
+ */
+typedef struct {
+    uint8_t buckets[LTC_HEALTH_NR_OF_BUCKETS];  /*!< frames with PEC error of the completed buckets  */
+    uint8_t bucket;                             /*!< bucket replaced by the current one              */
+    uint8_t nrOfBuckets;                        /*!< completed buckets in the window                 */
+    uint8_t frames;                             /*!< frames in the current bucket                    */
+    uint8_t errorFrames;                        /*!< frames with PEC error in the current bucket     */
+    uint16_t windowErrors;                      /*!< frames with PEC error of the completed buckets  */
+    uint8_t goodFrame;                          /*!< TRUE once a frame with correct PEC was received */
+    uint32_t lastGoodFrame;                     /*!< timestamp of the last frame with correct PEC    */
+} LTC_HEALTH_LTC_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+#if LTC_COMM_HEALTH == TRUE
+static LTC_HEALTH_LTC_s ltc_health_ltc[LTC_N_LTC];
+static DATA_BLOCK_LTC_COMMHEALTH_s ltc_health;
+static uint32_t ltc_health_lastUpdate = 0;
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#if LTC_COMM_HEALTH == TRUE
+void LTC_HEALTH_CountFrame(uint16_t ltc, uint8_t pecFailed) {
+
+    LTC_HEALTH_LTC_s *state = NULL_PTR;
+
+    if(ltc >= LTC_N_LTC) {
+        return;
+    }
+    state = &ltc_health_ltc[ltc];
+
+    state->frames++;
+    if(pecFailed == TRUE) {
+        state->errorFrames++;
+        ltc_health.pec_failing[ltc/32] |= ((uint32_t)1 << (ltc%32));
+    }
+    else {
+        state->goodFrame = TRUE;
+        state->lastGoodFrame = MCU_GetTimeStamp();
+        ltc_health.pec_failing[ltc/32] &= ~((uint32_t)1 << (ltc%32));
+    }
+
+    if(state->frames >= LTC_HEALTH_BUCKET_FRAMES) {
+        // the completed bucket replaces the oldest one of the window
+        state->windowErrors -= state->buckets[state->bucket];
+        state->windowErrors += state->errorFrames;
+        state->buckets[state->bucket] = state->errorFrames;
+        if(++state->bucket >= LTC_HEALTH_NR_OF_BUCKETS) {
+            state->bucket = 0;
+        }
+        if(state->nrOfBuckets < LTC_HEALTH_NR_OF_BUCKETS) {
+            state->nrOfBuckets++;
+        }
+        state->frames = 0;
+        state->errorFrames = 0;
+        ltc_health.pec_errors_per_1000[ltc] = (uint16_t)(((uint32_t)state->windowErrors*1000)/((uint32_t)state->nrOfBuckets*LTC_HEALTH_BUCKET_FRAMES));
+    }
+}
+
+
+void LTC_HEALTH_CountRetry(uint16_t ltc) {
+
+    if((ltc < LTC_N_LTC) && (ltc_health.retries[ltc] < 0xFFFF)) {
+        ltc_health.retries[ltc]++;
+    }
+}
+
+
+void LTC_HEALTH_CountMuxACK(uint16_t module, uint8_t muxID, uint8_t muxCh, uint8_t acknowledged) {
+
+    uint8_t channel = 0;
+    uint16_t *counter = NULL_PTR;
+
+    if((module >= BS_NR_OF_MODULES) || (muxID >= LTC_N_MUX_PER_LTC)) {
+        return;
+    }
+
+    if(muxCh < LTC_N_MUX_CHANNELS_PER_MUX) {
+        channel = muxID*LTC_N_MUX_CHANNELS_PER_MUX + muxCh;
+        counter = &ltc_health.mux_nacks[module][channel];
+        if(acknowledged == TRUE) {
+            ltc_health.mux_nack_channels[module] &= ~((uint32_t)1 << channel);
+        }
+        else {
+            ltc_health.mux_nack_channels[module] |= ((uint32_t)1 << channel);
+        }
+    }
+    else {
+        counter = &ltc_health.mux_nacks_off[module];
+    }
+
+    if((acknowledged == FALSE) && (*counter < 0xFFFF)) {
+        (*counter)++;
+    }
+}
+
+
+void LTC_HEALTH_Trigger(void) {
+
+    uint16_t ltc = 0;
+    uint32_t now = MCU_GetTimeStamp();
+
+    if((now - ltc_health_lastUpdate) < LTC_HEALTH_PERIOD_MS) {
+        return;
+    }
+    ltc_health_lastUpdate = now;
+
+    for(ltc=0;ltc<LTC_N_LTC;ltc++) {
+        if(ltc_health_ltc[ltc].goodFrame == TRUE) {
+            ltc_health.since_good_frame[ltc] = now - ltc_health_ltc[ltc].lastGoodFrame;
+        }
+        else {
+            ltc_health.since_good_frame[ltc] = 0xFFFFFFFF;
+        }
+    }
+
+    ltc_health.previous_timestamp = ltc_health.timestamp;
+    ltc_health.timestamp = now;
+    DATA_StoreDataBlock(&ltc_health, DATA_BLOCK_ID_LTC_COMMHEALTH);
+}
+#endif
@@ -0,0 +1,90 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_health.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_HEALTH
+ *
+ * @brief   Headers for the communication health statistics of the LTC daisy-chain.
+ *
+ */
+
+#ifndef LTC_HEALTH_H_
+#define LTC_HEALTH_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   counts a PEC checked frame of an LTC.
+ *
+ * Frames whose transfer failed are not counted.
+ *
+ * @param   ltc         index of the LTC (0 ... LTC_N_LTC-1)
+ * @param   pecFailed   TRUE if the PEC of the LTC was wrong, FALSE otherwise
+ *
+ * @return  void
+ */
+extern void LTC_HEALTH_CountFrame(uint16_t ltc, uint8_t pecFailed);
+
+/**
+ * @brief   counts a frame that is read again because of a PEC error of an LTC.
+ *
+ * @param   ltc     index of the LTC (0 ... LTC_N_LTC-1)
+ *
+ * @return  void
+ */
+extern void LTC_HEALTH_CountRetry(uint16_t ltc);
+
+/**
+ * @brief   counts the answer of a multiplexer to an I2C transfer.
+ *
+ * @param   module          module of the multiplexer
+ * @param   muxID           multiplexer ID
+ * @param   muxCh           selected channel, 0xFF if the multiplexer was switched off
+ * @param   acknowledged    TRUE if the multiplexer acknowledged the transfer, FALSE otherwise
+ *
+ * @return  void
+ */
+extern void LTC_HEALTH_CountMuxACK(uint16_t module, uint8_t muxID, uint8_t muxCh, uint8_t acknowledged);
+
+/**
+ * @brief   stores the statistics in DATA_BLOCK_ID_LTC_COMMHEALTH every LTC_HEALTH_PERIOD_MS.
+ *
+ * Must be called periodically (1ms).
+ *
+ * @return  void
+ */
+extern void LTC_HEALTH_Trigger(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_HEALTH_H_ */
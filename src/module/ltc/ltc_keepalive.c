@@ -0,0 +1,155 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_keepalive.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_KEEPALIVE
+ *
+ * @brief   Keep-alive of the isoSPI ports of the LTC daisy-chain.
+ *
+ * The isoSPI ports of the LTCs become idle LTC_TIDLE_US after the last frame, the next frame is
+ * then only used to wake them up and is lost. The idle time of the daisy-chain is measured from the end
+ * of the transfer of the last frame (SPI_GetIdleTime_us()), frames waiting in the SPI queue do not count:
+ * - the daisy-chain is awake if the last frame was transferred less than LTC_TIDLE_US-LTC_KEEPALIVE_MARGIN_US
+ *   ago or a frame is being transferred
+ * - LTC_KEEPALIVE_Trigger() sends a dummy byte one task cycle before this limit, so that the daisy-chain
+ *   stays awake while waiting for a conversion or for the next measurement cycle
+ * - if the limit is nevertheless exceeded (e.g. the task was delayed), a wake-up frame lasting
+ *   LTC_TREADY_US per LTC is queued in front of the next frame instead of losing it
+ *
+ * The cores of the LTCs go to sleep LTC_TSLEEP_US after the last valid command (watchdog). Wake-up
+ * frames and dummy bytes are no valid commands and do not reset the watchdog. If no valid command was
+ * queued for LTC_TSLEEP_US-LTC_KEEPALIVE_MARGIN_US, the daisy-chain is possibly asleep and has lost its
+ * configuration: the driver then runs the wake-up sequence (LTC_TWAKE_US per LTC) of the initialization
+ * again and configures the LTCs.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_keepalive.h"
+
+#include "mcu.h"
+#include "ltc_sim.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * maximum length of the wake-up frame in bytes
+ */
+#define LTC_KEEPALIVE_MAX_WAKEUP_BYTES      64
+
+/**
+ * period of LTC_KEEPALIVE_Trigger() in us
+ */
+#define LTC_KEEPALIVE_TRIGGER_PERIOD_US     1000
+
+/*================== Constant and Variable Definitions ====================*/
+
+#if LTC_KEEPALIVE == TRUE
+static uint8_t ltc_keepalive_framesent = FALSE;     // FALSE as long as no frame was sent
+static uint8_t ltc_keepalive_commandsent = FALSE;   // FALSE as long as no valid command was sent
+static uint32_t ltc_keepalive_lastcommand_ms = 0;
+static uint8_t ltc_keepalive_wakeupFrame[LTC_KEEPALIVE_MAX_WAKEUP_BYTES];
+static uint16_t ltc_keepalive_wakeupBytes = 1;
+static const uint8_t ltc_keepalive_dummy[1] = {0xFF};
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+#if LTC_KEEPALIVE == TRUE
+void LTC_KEEPALIVE_SetSPIClock(uint32_t spiClock) {
+
+    uint16_t i = 0;
+
+    // 8 clocks per byte, at least one byte
+    ltc_keepalive_wakeupBytes = 1 + ((uint32_t)LTC_N_LTC*LTC_TREADY_US*(spiClock/8))/(1000*1000);
+    if(ltc_keepalive_wakeupBytes > LTC_KEEPALIVE_MAX_WAKEUP_BYTES) {
+        ltc_keepalive_wakeupBytes = LTC_KEEPALIVE_MAX_WAKEUP_BYTES;
+    }
+    for(i=0;i<LTC_KEEPALIVE_MAX_WAKEUP_BYTES;i++) {
+        ltc_keepalive_wakeupFrame[i] = 0xFF;    // no valid command starts with 0xFF
+    }
+}
+
+
+void LTC_KEEPALIVE_FrameQueued(uint8_t command) {
+    ltc_keepalive_framesent = TRUE;
+    if(command == TRUE) {
+        // the watchdog starts at the end of the transfer, the time of queuing is conservative
+        ltc_keepalive_commandsent = TRUE;
+        ltc_keepalive_lastcommand_ms = MCU_GetTimeStamp();
+    }
+}
+
+
+LTC_KEEPALIVE_STATE_e LTC_KEEPALIVE_GetState(void) {
+
+    if((ltc_keepalive_commandsent == FALSE) ||
+            ((MCU_GetTimeStamp()-ltc_keepalive_lastcommand_ms) >= (LTC_TSLEEP_US-LTC_KEEPALIVE_MARGIN_US)/1000)) {
+        return LTC_KEEPALIVE_ASLEEP;
+    }
+    if((ltc_keepalive_framesent == FALSE) || (LTC_IdleTime_us() >= LTC_TIDLE_US-LTC_KEEPALIVE_MARGIN_US)) {
+        return LTC_KEEPALIVE_IDLE;
+    }
+    return LTC_KEEPALIVE_AWAKE;
+}
+
+
+STD_RETURN_TYPE_e LTC_KEEPALIVE_WakeUp(void) {
+
+    STD_RETURN_TYPE_e retVal = E_OK;
+
+    // only the isoSPI ports are woken up, a sleeping daisy-chain is initialized again by the driver
+    if((ltc_keepalive_framesent == FALSE) || (LTC_IdleTime_us() >= LTC_TIDLE_US-LTC_KEEPALIVE_MARGIN_US)) {
+        retVal = LTC_Transmit(ltc_keepalive_wakeupFrame, ltc_keepalive_wakeupBytes);
+        LTC_KEEPALIVE_FrameQueued(FALSE);
+    }
+    return retVal;
+}
+
+
+void LTC_KEEPALIVE_Trigger(void) {
+
+    uint32_t idletime_us = LTC_IdleTime_us();
+
+    // an idle daisy-chain is woken up in front of the next frame anyway
+    if((ltc_keepalive_framesent == TRUE) &&
+            (idletime_us >= LTC_TIDLE_US-LTC_KEEPALIVE_MARGIN_US-LTC_KEEPALIVE_TRIGGER_PERIOD_US) &&
+            (idletime_us < LTC_TIDLE_US-LTC_KEEPALIVE_MARGIN_US)) {
+        (void)LTC_Transmit((uint8_t *)ltc_keepalive_dummy, 1);
+        LTC_KEEPALIVE_FrameQueued(FALSE);
+    }
+}
+#endif
@@ -0,0 +1,107 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_keepalive.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_KEEPALIVE
+ *
+ * @brief   Headers for the keep-alive of the isoSPI ports of the LTC daisy-chain.
+ *
+ */
+
+#ifndef LTC_KEEPALIVE_H_
+#define LTC_KEEPALIVE_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * state of the daisy-chain derived from the time since the transfer of the last frame (isoSPI ports)
+ * and since the last valid command (watchdog of the LTCs)
+ */
+typedef enum {
+    LTC_KEEPALIVE_AWAKE     = 0,    /*!< isoSPI ports ready, frames can be sent directly                      */
+    LTC_KEEPALIVE_IDLE      = 1,    /*!< isoSPI ports possibly idle, a wake-up frame is needed                */
+    LTC_KEEPALIVE_ASLEEP    = 2,    /*!< no valid command sent yet or for tSLEEP, configuration possibly lost */
+} LTC_KEEPALIVE_STATE_e;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   sets the SPI clock used to size the wake-up frame.
+ *
+ * The wake-up frame lasts at least LTC_TREADY_US per LTC of the daisy-chain.
+ *
+ * @param   spiClock    SPI clock in Hz
+ *
+ * @return  void
+ */
+extern void LTC_KEEPALIVE_SetSPIClock(uint32_t spiClock);
+
+/**
+ * @brief   records that a frame was queued.
+ *
+ * The idle time itself is measured from the end of the transfer of the last frame. Only valid
+ * commands reset the watchdog, wake-up frames and dummy bytes do not.
+ *
+ * @param   command     TRUE if the frame is a valid command, FALSE otherwise
+ *
+ * @return  void
+ */
+extern void LTC_KEEPALIVE_FrameQueued(uint8_t command);
+
+/**
+ * @brief   gets the state of the daisy-chain.
+ *
+ * @return  state of the daisy-chain
+ */
+extern LTC_KEEPALIVE_STATE_e LTC_KEEPALIVE_GetState(void);
+
+/**
+ * @brief   queues a wake-up frame if the isoSPI ports of the daisy-chain are possibly idle.
+ *
+ * Must be called before a frame is queued. Nothing is sent if the isoSPI ports are awake. A daisy-chain
+ * in state LTC_KEEPALIVE_ASLEEP is not woken up here, the driver runs the initialization again.
+ *
+ * @return  E_OK if the isoSPI ports are awake or the wake-up frame was queued, E_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e LTC_KEEPALIVE_WakeUp(void);
+
+/**
+ * @brief   sends a dummy byte if the isoSPI ports of the daisy-chain would become idle.
+ *
+ * Must be called periodically (1ms) while the daisy-chain is initialized.
+ *
+ * @return  void
+ */
+extern void LTC_KEEPALIVE_Trigger(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_KEEPALIVE_H_ */
@@ -0,0 +1,358 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+/**
+ * @file    ltc_muxsched.c
+ * @author  foxBMS Team
+ * @date    16.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_MUXSCHED
+ *
+ * @brief   Scheduling of the multiplexer measurements.
+ *
+ * The LTC driver measures the multiplexer channels in rounds. With LTC_MUX_ADAPTIVE_SCHEDULING
+ * set to FALSE, a round is the configured sequence ltc_mux_seq. With LTC_MUX_ADAPTIVE_SCHEDULING
+ * set to TRUE, the first round is the configured sequence, the following rounds are planned here:
+ *
+ * - a round has as many measurements as there are channels in the configured sequence
+ * - channels whose temperature changes by more than LTC_MUX_SCHED_HOT_RATE or which are closer than
+ *   LTC_MUX_SCHED_LIMIT_MARGIN to BC_TEMPMAX/BC_TEMPMIN ("hot" channels) are measured
+ *   LTC_MUX_SCHED_HOT_PASSES times per round, spread over the round
+ * - the remaining measurements go to the other channels, the oldest first. A channel is never
+ *   left out for more than LTC_MUX_SCHED_MAX_SKIP consecutive rounds
+ * - before a channel of another multiplexer is selected, the active multiplexer is switched off
+ *
+ * The timestamps of the last measurement of all channels are stored in DATA_BLOCK_ID_MUXAGE
+ * at the start of each round.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_muxsched.h"
+
+#include "database.h"
+#include "mcu.h"
+#include "batterycell_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if DATA_NR_OF_MUX_CHANNELS != LTC_N_MUX_CHANNELS_PER_LTC
+#error "DATA_NR_OF_MUX_CHANNELS must be equal to LTC_N_MUX_CHANNELS_PER_LTC"
+#endif
+
+/**
+ * index of a multiplexer channel in ltc_muxsched_channel and DATA_BLOCK_MUXAGE_s
+ */
+#define LTC_MUXSCHED_CHANNEL(muxID, muxCh)  ((muxID)*LTC_N_MUX_CHANNELS_PER_MUX+(muxCh))
+
+/**
+ * maximum length of a planned round: every measurement may need a step to switch off the previous multiplexer
+ */
+#define LTC_MUXSCHED_PLAN_LENGTH            (2*LTC_N_MUX_CHANNELS_PER_LTC)
+
+/**
+ * number of rounds a channel stays hot after the last fast change
+ */
+#define LTC_MUXSCHED_HOT_HOLD               2
+
+/**
+ * no multiplexer switched on
+ */
+#define LTC_MUXSCHED_NO_MUX                 0xFF
+
+/**
+ * scheduling state of a multiplexer channel
+ */
+typedef struct {
+    uint8_t inSequence;         /*!< TRUE if the channel is measured in the configured sequence                 */
+    uint8_t hot;                /*!< number of rounds the channel is still measured more often                  */
+    uint8_t skipped;            /*!< number of consecutive rounds the channel was left out                      */
+    int16_t temperatureMin;     /*!< lowest temperature of the last measurement, unit: 0.1 degree Celsius       */
+    int16_t temperatureMax;     /*!< highest temperature of the last measurement, unit: 0.1 degree Celsius      */
+} LTC_MUXSCHED_CHANNEL_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+static LTC_MUXSCHED_CHANNEL_s ltc_muxsched_channel[LTC_N_MUX_CHANNELS_PER_LTC];
+static DATA_BLOCK_MUXAGE_s ltc_muxage;
+
+#if LTC_MUX_ADAPTIVE_SCHEDULING == TRUE
+static LTC_MUX_CH_CFG_s ltc_muxsched_plan[LTC_MUXSCHED_PLAN_LENGTH];
+static uint8_t ltc_muxsched_plan_length = 0;
+static uint8_t ltc_muxsched_enabledMux = LTC_MUXSCHED_NO_MUX;
+static uint8_t ltc_muxsched_firstRound = TRUE;
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+#if LTC_MUX_ADAPTIVE_SCHEDULING == TRUE
+static void LTC_MUXSCHED_ScanSequence(void);
+static void LTC_MUXSCHED_AddStep(uint8_t channel);
+static void LTC_MUXSCHED_BuildPlan(void);
+#endif
+
+/*================== Function Implementations =============================*/
+
+/*================== Public functions =====================================*/
+
+void LTC_MUXSCHED_Init(void) {
+
+#if LTC_MUX_ADAPTIVE_SCHEDULING == TRUE
+    ltc_muxsched_firstRound = TRUE;
+#endif
+}
+
+
+LTC_MUX_CH_CFG_s *LTC_MUXSCHED_NextRound(uint8_t *nr_of_steps) {
+
+    LTC_MUX_CH_CFG_s *seqptr = ltc_mux_seq.seqptr;
+
+    *nr_of_steps = ltc_mux_seq.nr_of_steps;
+
+#if LTC_MUX_ADAPTIVE_SCHEDULING == TRUE
+    if(ltc_muxsched_firstRound == FALSE) {
+        LTC_MUXSCHED_BuildPlan();
+        *nr_of_steps = ltc_muxsched_plan_length;
+        seqptr = &ltc_muxsched_plan[0];
+    }
+    else {
+        ltc_muxsched_firstRound = FALSE;
+        LTC_MUXSCHED_ScanSequence();
+    }
+#endif
+
+    // the measurement ages of the finished round are stored once per round, not after every channel
+    ltc_muxage.previous_timestamp = ltc_muxage.timestamp;
+    ltc_muxage.timestamp = MCU_GetTimeStamp();
+    DATA_StoreDataBlock(&ltc_muxage, DATA_BLOCK_ID_MUXAGE);
+
+    return seqptr;
+}
+
+
+void LTC_MUXSCHED_ChannelMeasured(LTC_MUX_CH_CFG_s *muxseqptr, uint8_t isTemperature, int16_t temperatureMin, int16_t temperatureMax) {
+
+    uint8_t channel = 0;
+    uint32_t now = MCU_GetTimeStamp();
+    uint32_t dt = 0;
+    int32_t change = 0;
+    LTC_MUXSCHED_CHANNEL_s *state = NULL_PTR;
+
+    if((muxseqptr->muxID >= LTC_N_MUX_PER_LTC) || (muxseqptr->muxCh >= LTC_N_MUX_CHANNELS_PER_MUX)) {
+        return;
+    }
+    channel = LTC_MUXSCHED_CHANNEL(muxseqptr->muxID, muxseqptr->muxCh);
+    state = &ltc_muxsched_channel[channel];
+
+    if(isTemperature == TRUE) {
+        if(ltc_muxage.last_measurement[channel] != 0) {
+            dt = now - ltc_muxage.last_measurement[channel];
+            change = temperatureMax - state->temperatureMax;
+            if(change < 0) {
+                change = -change;
+            }
+            if(temperatureMin - state->temperatureMin > change) {
+                change = temperatureMin - state->temperatureMin;
+            }
+            if(state->temperatureMin - temperatureMin > change) {
+                change = state->temperatureMin - temperatureMin;
+            }
+            // a change of 0.1 degree Celsius is treated as noise
+            if((change > 1) && ((uint32_t)change*1000 >= (uint32_t)LTC_MUX_SCHED_HOT_RATE*dt)) {
+                state->hot = LTC_MUXSCHED_HOT_HOLD;
+            }
+        }
+        if((temperatureMax >= BC_TEMPMAX*10-LTC_MUX_SCHED_LIMIT_MARGIN) || (temperatureMin <= BC_TEMPMIN*10+LTC_MUX_SCHED_LIMIT_MARGIN)) {
+            state->hot = LTC_MUXSCHED_HOT_HOLD;
+        }
+        state->temperatureMin = temperatureMin;
+        state->temperatureMax = temperatureMax;
+    }
+
+    ltc_muxage.last_measurement[channel] = now;
+}
+
+/*================== Static functions =====================================*/
+
+#if LTC_MUX_ADAPTIVE_SCHEDULING == TRUE
+/**
+ * @brief   gets the channels of the configured sequence and the multiplexer switched on at its end.
+ *
+ * @return  void
+ */
+static void LTC_MUXSCHED_ScanSequence(void) {
+
+    uint8_t i = 0;
+    LTC_MUX_CH_CFG_s *muxseqptr = ltc_mux_seq.seqptr;
+
+    for(i=0;i<LTC_N_MUX_CHANNELS_PER_LTC;i++) {
+        ltc_muxsched_channel[i].inSequence = FALSE;
+    }
+
+    ltc_muxsched_enabledMux = LTC_MUXSCHED_NO_MUX;
+    for(i=0;i<ltc_mux_seq.nr_of_steps;i++,muxseqptr++) {
+        if(muxseqptr->muxID >= LTC_N_MUX_PER_LTC) {
+            continue;
+        }
+        if(muxseqptr->muxCh == 0xFF) {
+            if(ltc_muxsched_enabledMux == muxseqptr->muxID) {
+                ltc_muxsched_enabledMux = LTC_MUXSCHED_NO_MUX;
+            }
+        }
+        else if(muxseqptr->muxCh < LTC_N_MUX_CHANNELS_PER_MUX) {
+            ltc_muxsched_channel[LTC_MUXSCHED_CHANNEL(muxseqptr->muxID, muxseqptr->muxCh)].inSequence = TRUE;
+            ltc_muxsched_enabledMux = muxseqptr->muxID;
+        }
+    }
+}
+
+
+/**
+ * @brief   adds the measurement of a channel to the planned round.
+ *
+ * Only one multiplexer output may be connected to the GPIO, so the active multiplexer
+ * is switched off first if the channel belongs to another multiplexer.
+ *
+ * @param   channel     channel index (muxID*8+muxCh)
+ *
+ * @return  void
+ */
+static void LTC_MUXSCHED_AddStep(uint8_t channel) {
+
+    uint8_t muxID = channel/LTC_N_MUX_CHANNELS_PER_MUX;
+
+    if((ltc_muxsched_enabledMux != LTC_MUXSCHED_NO_MUX) && (ltc_muxsched_enabledMux != muxID)) {
+        ltc_muxsched_plan[ltc_muxsched_plan_length].muxID = ltc_muxsched_enabledMux;
+        ltc_muxsched_plan[ltc_muxsched_plan_length].muxCh = 0xFF;
+        ltc_muxsched_plan_length++;
+    }
+    ltc_muxsched_plan[ltc_muxsched_plan_length].muxID = muxID;
+    ltc_muxsched_plan[ltc_muxsched_plan_length].muxCh = channel%LTC_N_MUX_CHANNELS_PER_MUX;
+    ltc_muxsched_plan_length++;
+    ltc_muxsched_enabledMux = muxID;
+}
+
+
+/**
+ * @brief   plans the next round of multiplexer measurements.
+ *
+ * The other channels are split in LTC_MUX_SCHED_HOT_PASSES parts and the hot channels are
+ * measured after each part. If the channels that reached LTC_MUX_SCHED_MAX_SKIP do not fit in
+ * the remaining measurements, the number of passes is reduced.
+ *
+ * @return  void
+ */
+static void LTC_MUXSCHED_BuildPlan(void) {
+
+    uint8_t i = 0;
+    uint8_t j = 0;
+    uint8_t tmp = 0;
+    uint8_t hot[LTC_N_MUX_CHANNELS_PER_LTC];
+    uint8_t other[LTC_N_MUX_CHANNELS_PER_LTC];
+    uint8_t selected[LTC_N_MUX_CHANNELS_PER_LTC];
+    uint8_t nr_of_hot = 0;
+    uint8_t nr_of_other = 0;
+    uint8_t nr_of_mandatory = 0;
+    uint8_t nr_of_selected = 0;
+    uint8_t nr_of_measurements = 0;
+    uint8_t passes = LTC_MUX_SCHED_HOT_PASSES;
+    uint8_t pass = 0;
+    LTC_MUXSCHED_CHANNEL_s *state = NULL_PTR;
+
+    ltc_muxage.hot_channels = 0;
+    for(i=0;i<LTC_N_MUX_CHANNELS_PER_LTC;i++) {
+        state = &ltc_muxsched_channel[i];
+        selected[i] = FALSE;
+        if(state->inSequence == FALSE) {
+            continue;
+        }
+        nr_of_measurements++;
+        if(state->hot > 0) {
+            state->hot--;
+            state->skipped = 0;
+            hot[nr_of_hot++] = i;
+            ltc_muxage.hot_channels |= (1u << i);
+        }
+        else {
+            if(state->skipped >= LTC_MUX_SCHED_MAX_SKIP) {
+                nr_of_mandatory++;
+            }
+            other[nr_of_other++] = i;
+        }
+    }
+
+    if(nr_of_hot == 0) {
+        passes = 1;
+    }
+    while((passes > 1) && (passes*nr_of_hot+nr_of_mandatory > nr_of_measurements)) {
+        passes--;
+    }
+
+    // most skipped and oldest channels first
+    for(i=0;i<nr_of_other;i++) {
+        for(j=i+1;j<nr_of_other;j++) {
+            if((ltc_muxsched_channel[other[j]].skipped > ltc_muxsched_channel[other[i]].skipped) ||
+               ((ltc_muxsched_channel[other[j]].skipped == ltc_muxsched_channel[other[i]].skipped) &&
+                (ltc_muxage.last_measurement[other[j]] < ltc_muxage.last_measurement[other[i]]))) {
+                tmp = other[i];
+                other[i] = other[j];
+                other[j] = tmp;
+            }
+        }
+    }
+
+    for(i=0;i<nr_of_other;i++) {
+        if(i < nr_of_measurements-passes*nr_of_hot) {
+            selected[other[i]] = TRUE;
+            ltc_muxsched_channel[other[i]].skipped = 0;
+        }
+        else {
+            ltc_muxsched_channel[other[i]].skipped++;
+        }
+    }
+
+    // selected channels in ascending order, so that the channels of a multiplexer follow each other
+    for(i=0;i<LTC_N_MUX_CHANNELS_PER_LTC;i++) {
+        if(selected[i] == TRUE) {
+            other[nr_of_selected++] = i;
+        }
+    }
+
+    ltc_muxsched_plan_length = 0;
+    j = 0;
+    for(pass=0;pass<passes;pass++) {
+        for(;j<(pass+1)*nr_of_selected/passes;j++) {
+            LTC_MUXSCHED_AddStep(other[j]);
+        }
+        for(i=0;i<nr_of_hot;i++) {
+            LTC_MUXSCHED_AddStep(hot[i]);
+        }
+    }
+}
+#endif
@@ -0,0 +1,84 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+/**
+ * @file    ltc_muxsched.h
+ * @author  foxBMS Team
+ * @date    16.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_MUXSCHED
+ *
+ * @brief   Headers for the scheduling of the multiplexer measurements.
+ *
+ */
+
+#ifndef LTC_MUXSCHED_H_
+#define LTC_MUXSCHED_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   restarts the multiplexer scheduling.
+ *
+ * The next round is the configured sequence ltc_mux_seq, so that all multiplexers are in a known
+ * state afterwards. The timestamps of the last measurements are kept.
+ *
+ * @return  void
+ */
+extern void LTC_MUXSCHED_Init(void);
+
+/**
+ * @brief   gets the multiplexer sequence of the next round.
+ *
+ * If LTC_MUX_ADAPTIVE_SCHEDULING is FALSE, this is always the configured sequence ltc_mux_seq.
+ * The measurement ages of the finished round are stored in DATA_BLOCK_ID_MUXAGE.
+ *
+ * @param   *nr_of_steps    number of steps in the sequence (output)
+ *
+ * @return  pointer to the first step of the sequence
+ */
+extern LTC_MUX_CH_CFG_s *LTC_MUXSCHED_NextRound(uint8_t *nr_of_steps);
+
+/**
+ * @brief   updates the state of a multiplexer channel after its measurement.
+ *
+ * The minimum and maximum temperature of all LTCs on the channel are used to detect channels
+ * that change quickly or are close to a limit. They are ignored if isTemperature is FALSE.
+ *
+ * @param   *muxseqptr      measured multiplexer channel
+ * @param   isTemperature   TRUE if a temperature sensor is connected to the channel
+ * @param   temperatureMin  lowest temperature measured on the channel, unit: 0.1 degree Celsius
+ * @param   temperatureMax  highest temperature measured on the channel, unit: 0.1 degree Celsius
+ *
+ * @return  void
+ */
+extern void LTC_MUXSCHED_ChannelMeasured(LTC_MUX_CH_CFG_s *muxseqptr, uint8_t isTemperature, int16_t temperatureMin, int16_t temperatureMax);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_MUXSCHED_H_ */
@@ -0,0 +1,91 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+/**
+ * @file    ltc_ntc.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_NTC
+ *
+ * @brief   Conversion of the multiplexer voltages to temperatures.
+ *
+ * The temperatures are read from NTC elements via voltage dividers. The lookup tables of the
+ * NTC types are generated by module/config/ltc_ntc_cfg.py on a uniform grid of raw values, so
+ * the table index is a shift of the raw value and the temperature is interpolated between two
+ * entries with integer arithmetic.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_ntc.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/*================== Function Implementations =============================*/
+
+/*================== Public functions =====================================*/
+
+int16_t LTC_NTC_Convert(LTC_NTC_TYPE_e type, uint16_t raw) {
+
+    const int16_t *lut = ltc_ntc_lut[type];
+    uint16_t idx = raw >> LTC_NTC_LUT_SHIFT;
+    uint32_t frac = raw & ((1u << LTC_NTC_LUT_SHIFT)-1);
+    int32_t temperature = 0;
+
+    if(idx >= LTC_NTC_LUT_LENGTH-1) {
+        temperature = lut[LTC_NTC_LUT_LENGTH-1];
+    }
+    else {
+        // the tables are falling, so the difference is positive
+        temperature = lut[idx] - (int32_t)(((uint32_t)(lut[idx]-lut[idx+1])*frac) >> LTC_NTC_LUT_SHIFT);
+    }
+
+    // 0.01 -> 0.1 degree Celsius
+    if(temperature >= 0) {
+        return (int16_t)((temperature+5)/10);
+    }
+    return (int16_t)(-((-temperature+5)/10));
+}
+
+
+void LTC_NTC_ConvertModule(const uint8_t *muxVoltages, int16_t *temperature) {
+
+    uint8_t i = 0;
+    uint8_t channel = 0;
+
+    for(i=0;i<BS_NR_OF_TEMP_SENSORS_PER_MODULE;i++) {
+        channel = ltc_tempsensor_cfg[i].muxID*LTC_N_MUX_CHANNELS_PER_MUX+ltc_tempsensor_cfg[i].muxCh;
+        temperature[i] = LTC_NTC_Convert(ltc_tempsensor_cfg[i].type, muxVoltages[2*channel] | (muxVoltages[2*channel+1] << 8));
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+/**
+ * @file    ltc_ntc.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_NTC
+ *
+ * @brief   Headers for the conversion of the multiplexer voltages to temperatures.
+ *
+ */
+
+#ifndef LTC_NTC_H_
+#define LTC_NTC_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   converts the voltage of a NTC voltage divider to a temperature.
+ *
+ * The temperature is interpolated in the lookup table of the sensor type (ltc_ntc_cfg.c)
+ * with integer arithmetic only.
+ *
+ * @param   type    NTC sensor type
+ * @param   raw     voltage measured on the GPIO, unit: 100uV
+ *
+ * @return  temperature, unit: 0.1 degree Celsius
+ */
+extern int16_t LTC_NTC_Convert(LTC_NTC_TYPE_e type, uint16_t raw);
+
+/**
+ * @brief   converts the multiplexer voltages of a module to the temperatures of its sensors.
+ *
+ * The multiplexer channel and the type of each sensor are configured in ltc_tempsensor_cfg.
+ *
+ * @param   *muxVoltages    raw multiplexer voltages of the LTC of the module, 2 bytes (LSB first) per channel,
+ *                          LTC_N_MUX_CHANNELS_PER_LTC channels
+ * @param   *temperature    temperatures of the BS_NR_OF_TEMP_SENSORS_PER_MODULE sensors (output), unit: 0.1 degree Celsius
+ *
+ * @return  void
+ */
+extern void LTC_NTC_ConvertModule(const uint8_t *muxVoltages, int16_t *temperature);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_NTC_H_ */
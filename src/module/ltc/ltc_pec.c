@@ -79,6 +79,47 @@ Copyright 2013 Linear Technology Corp. (LTC)
 
 /*================== Constant and Variable Definitions ====================*/
 
+/**
+ * Slice-by-2 extension of crc15Table: crc15Table_2[a] is the remainder
+ * contribution of table address a after two further bytes have been shifted
+ * through the register, i.e. (crc15Table[a]<<8)^crc15Table[(crc15Table[a]>>7)&0xff].
+ * Bit 15 is don't care like in crc15Table.
+ */
+static const uint16_t crc15Table_2[256] = {
+    0x0000, 0xc426, 0x4dd5, 0x89f3, 0x5e33, 0x9a15, 0x13e6, 0xd7c0,
+    0xf9ff, 0x3dd9, 0xb42a, 0x700c, 0xa7cc, 0x63ea, 0xea19, 0x2e3f,
+    0x3667, 0xf241, 0x7bb2, 0xbf94, 0x6854, 0xac72, 0x2581, 0xe1a7,
+    0xcf98, 0x0bbe, 0x824d, 0x466b, 0x91ab, 0x558d, 0xdc7e, 0x1858,
+    0x6cce, 0xa8e8, 0x211b, 0xe53d, 0x32fd, 0xf6db, 0x7f28, 0xbb0e,
+    0x9531, 0x5117, 0xd8e4, 0x1cc2, 0xcb02, 0x0f24, 0x86d7, 0x42f1,
+    0x5aa9, 0x9e8f, 0x177c, 0xd35a, 0x049a, 0xc0bc, 0x494f, 0x8d69,
+    0xa356, 0x6770, 0xee83, 0x2aa5, 0xfd65, 0x3943, 0xb0b0, 0x7496,
+    0x1c05, 0xd823, 0x51d0, 0x95f6, 0x4236, 0x8610, 0x0fe3, 0xcbc5,
+    0xe5fa, 0x21dc, 0xa82f, 0x6c09, 0xbbc9, 0x7fef, 0xf61c, 0x323a,
+    0x2a62, 0xee44, 0x67b7, 0xa391, 0x7451, 0xb077, 0x3984, 0xfda2,
+    0xd39d, 0x17bb, 0x9e48, 0x5a6e, 0x8dae, 0x4988, 0xc07b, 0x045d,
+    0x70cb, 0xb4ed, 0x3d1e, 0xf938, 0x2ef8, 0xeade, 0x632d, 0xa70b,
+    0x8934, 0x4d12, 0xc4e1, 0x00c7, 0xd707, 0x1321, 0x9ad2, 0x5ef4,
+    0x46ac, 0x828a, 0x0b79, 0xcf5f, 0x189f, 0xdcb9, 0x554a, 0x916c,
+    0xbf53, 0x7b75, 0xf286, 0x36a0, 0xe160, 0x2546, 0xacb5, 0x6893,
+    0x380a, 0xfc2c, 0x75df, 0xb1f9, 0x6639, 0xa21f, 0x2bec, 0xefca,
+    0xc1f5, 0x05d3, 0x8c20, 0x4806, 0x9fc6, 0x5be0, 0xd213, 0x1635,
+    0x0e6d, 0xca4b, 0x43b8, 0x879e, 0x505e, 0x9478, 0x1d8b, 0xd9ad,
+    0xf792, 0x33b4, 0xba47, 0x7e61, 0xa9a1, 0x6d87, 0xe474, 0x2052,
+    0x54c4, 0x90e2, 0x1911, 0xdd37, 0x0af7, 0xced1, 0x4722, 0x8304,
+    0xad3b, 0x691d, 0xe0ee, 0x24c8, 0xf308, 0x372e, 0xbedd, 0x7afb,
+    0x62a3, 0xa685, 0x2f76, 0xeb50, 0x3c90, 0xf8b6, 0x7145, 0xb563,
+    0x9b5c, 0x5f7a, 0xd689, 0x12af, 0xc56f, 0x0149, 0x88ba, 0x4c9c,
+    0x240f, 0xe029, 0x69da, 0xadfc, 0x7a3c, 0xbe1a, 0x37e9, 0xf3cf,
+    0xddf0, 0x19d6, 0x9025, 0x5403, 0x83c3, 0x47e5, 0xce16, 0x0a30,
+    0x1268, 0xd64e, 0x5fbd, 0x9b9b, 0x4c5b, 0x887d, 0x018e, 0xc5a8,
+    0xeb97, 0x2fb1, 0xa642, 0x6264, 0xb5a4, 0x7182, 0xf871, 0x3c57,
+    0x48c1, 0x8ce7, 0x0514, 0xc132, 0x16f2, 0xd2d4, 0x5b27, 0x9f01,
+    0xb13e, 0x7518, 0xfceb, 0x38cd, 0xef0d, 0x2b2b, 0xa2d8, 0x66fe,
+    0x7ea6, 0xba80, 0x3373, 0xf755, 0x2095, 0xe4b3, 0x6d40, 0xa966,
+    0x8759, 0x437f, 0xca8c, 0x0eaa, 0xd96a, 0x1d4c, 0x94bf, 0x5099
+};
+
 /*================== Function Prototypes ==================================*/
 
 /*================== Function Implementations =============================*/
@@ -87,17 +128,62 @@ uint16_t LTC_pec15_calc(uint8_t len, //Number of bytes that will be used to calc
                     uint8_t *data //Array of data that will be used to calculate  a PEC
                     )
 {
-    uint16_t remainder,addr;
+    uint16_t remainder;
+    uint8_t i = 0;
 
     remainder = 16;//initialize the PEC
-    for(uint8_t i = 0; i<len;i++) // loops for each byte in data array
+    for(i = 0; (i+1)<len; i+=2) // two bytes per step with the slice-by-2 table
+    {
+        remainder = crc15Table_2[((remainder>>7)^data[i])&0xff] ^
+                    crc15Table[((remainder<<1)^data[i+1])&0xff];
+    }
+    if(i<len) // remaining odd byte
     {
-        addr = ((remainder>>7)^data[i])&0xff;//calculate PEC table address
-        remainder = (remainder<<8)^crc15Table[addr];
+        remainder = (remainder<<8)^crc15Table[((remainder>>7)^data[i])&0xff];
     }
     return(remainder*2);//The CRC15 has a 0 in the LSB so the remainder must be multiplied by 2
 }
 
+
+uint8_t LTC_pec15_check(uint8_t *data)
+{
+    uint16_t remainder = 16;
+
+    // 6 data bytes followed by the received PEC: the remainder over all
+    // 8 bytes is zero if and only if the received PEC is correct
+    remainder = crc15Table_2[((remainder>>7)^data[0])&0xff] ^ crc15Table[((remainder<<1)^data[1])&0xff];
+    remainder = crc15Table_2[((remainder>>7)^data[2])&0xff] ^ crc15Table[((remainder<<1)^data[3])&0xff];
+    remainder = crc15Table_2[((remainder>>7)^data[4])&0xff] ^ crc15Table[((remainder<<1)^data[5])&0xff];
+    remainder = crc15Table_2[((remainder>>7)^data[6])&0xff] ^ crc15Table[((remainder<<1)^data[7])&0xff];
+
+    return(((remainder & 0x7FFF) == 0) ? TRUE : FALSE);
+}
+
+
+uint16_t LTC_pec15_check_frame(uint8_t *frame, uint16_t nr_of_ltcs, uint32_t *failmap)
+{
+    uint16_t nr_of_errors = 0;
+    uint16_t i = 0;
+    uint8_t *data = &frame[4];  // skip command and command PEC
+
+    for(i = 0; i<LTC_PEC_FAILMAP_WORDS(nr_of_ltcs); i++)
+    {
+        failmap[i] = 0;
+    }
+
+    for(i = 0; i<nr_of_ltcs; i++)
+    {
+        if(LTC_pec15_check(data) == FALSE)
+        {
+            failmap[i/32] |= (uint32_t)1 << (i%32);
+            nr_of_errors++;
+        }
+        data += 8;
+    }
+
+    return(nr_of_errors);
+}
+
 /*================== Public functions =====================================*/
 
 /*================== Static functions =====================================*/
@@ -78,6 +78,34 @@ void generate_crc15_table()
 
 /*================== Macros and Definitions ===============================*/
 
+/**
+ * number of 32 bit words needed for the failure bitmap of LTC_pec15_check_frame()
+ */
+#define LTC_PEC_FAILMAP_WORDS(nr_of_ltcs)   (((nr_of_ltcs)+31)/32)
+
+/**
+ * PEC15 of a 2 byte command word, evaluated by the compiler.
+ * The CRC is linear in the data bits, so the PEC of a command is the PEC of 0x0000
+ * XOR the contribution of each set bit. The constants were generated with LTC_pec15_calc().
+ */
+#define LTC_PEC15_CMD_BIT(cmd, bit, pec)    ((((cmd) >> (bit)) & 1u) ? (pec) : 0u)
+#define LTC_PEC15_CMD(cmd)  ((uint16_t)(0xB65Cu ^ \
+    LTC_PEC15_CMD_BIT((cmd), 0, 0x8B32u) ^ LTC_PEC15_CMD_BIT((cmd), 1, 0x9D56u) ^ \
+    LTC_PEC15_CMD_BIT((cmd), 2, 0xB19Eu) ^ LTC_PEC15_CMD_BIT((cmd), 3, 0xE80Eu) ^ \
+    LTC_PEC15_CMD_BIT((cmd), 4, 0x5B2Eu) ^ LTC_PEC15_CMD_BIT((cmd), 5, 0xB65Cu) ^ \
+    LTC_PEC15_CMD_BIT((cmd), 6, 0xE78Au) ^ LTC_PEC15_CMD_BIT((cmd), 7, 0x4426u) ^ \
+    LTC_PEC15_CMD_BIT((cmd), 8, 0x884Cu) ^ LTC_PEC15_CMD_BIT((cmd), 9, 0x9BAAu) ^ \
+    LTC_PEC15_CMD_BIT((cmd), 10, 0xBC66u) ^ LTC_PEC15_CMD_BIT((cmd), 11, 0xF3FEu) ^ \
+    LTC_PEC15_CMD_BIT((cmd), 12, 0x6CCEu) ^ LTC_PEC15_CMD_BIT((cmd), 13, 0xD99Cu) ^ \
+    LTC_PEC15_CMD_BIT((cmd), 14, 0x380Au) ^ LTC_PEC15_CMD_BIT((cmd), 15, 0x7014u)))
+
+/**
+ * the 4 bytes sent for a command: command word (MSB first) followed by its PEC,
+ * to be used in the initializer of a uint8_t array
+ */
+#define LTC_CMD_WITH_PEC(cmd)   (uint8_t)(((cmd) >> 8) & 0xFFu), (uint8_t)((cmd) & 0xFFu), \
+                                (uint8_t)(LTC_PEC15_CMD(cmd) >> 8), (uint8_t)(LTC_PEC15_CMD(cmd) & 0xFFu)
+
 /*================== Constant and Variable Definitions ====================*/
 
 static const unsigned int crc15Table[256] = {0x0,0xc599, 0xceab, 0xb32, 0xd8cf, 0x1d56, 0x1664, 0xd3fd, 0xf407, 0x319e, 0x3aac,  //!<precomputed CRC15 Table
@@ -109,6 +137,29 @@ static const unsigned int crc15Table[256] = {0x0,0xc599, 0xceab, 0xb32, 0xd8cf,
 
 uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data);
 
+/**
+ * @brief   checks the PEC of the data of one LTC
+ *
+ * @param   data    6 data bytes followed by the 2 PEC bytes received from the LTC
+ *
+ * @return  TRUE if the PEC is correct, FALSE otherwise
+ */
+uint8_t LTC_pec15_check(uint8_t *data);
+
+/**
+ * @brief   verifies all data PECs of a frame received from the daisy-chain in one pass
+ *
+ * The frame layout is 2 bytes command, 2 bytes PEC and then 6 data bytes plus
+ * 2 bytes PEC for each LTC. The data is checked in place, no copy is made.
+ *
+ * @param   frame       received frame including the command bytes
+ * @param   nr_of_ltcs  number of LTCs in the daisy-chain
+ * @param   failmap     bitmap with LTC_PEC_FAILMAP_WORDS(nr_of_ltcs) words, bit i is set if the PEC of LTC i is wrong
+ *
+ * @return  number of LTCs with wrong PEC
+ */
+uint16_t LTC_pec15_check_frame(uint8_t *frame, uint16_t nr_of_ltcs, uint32_t *failmap);
+
 /*================== Function Implementations =============================*/
 
 #endif /* LTC_PEC_H_ */
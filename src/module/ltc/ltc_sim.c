@@ -0,0 +1,863 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_sim.c
+ * @author  foxBMS Team
+ * @date    16.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_SIM
+ *
+ * @brief   Simulated LTC6804/LTC6811/LTC6813 daisy-chain.
+ *
+ * If LTC_SIMULATION is set to TRUE in ltc_cfg.h, the transmit macros of the LTC driver
+ * are redirected to this module instead of the SPI interface. The simulation answers the
+ * commands used by the driver (WRCFG, RDCFG, ADCV, ADAX, ADCVAX, RDCVA-F, RDAUXA/B, WRCOMM,
+ * STCOMM, RDCOMM) for LTC_N_LTC devices with correct PECs and takes the conversion times
+ * of the devices into account. It is used to measure the cycle time and the CPU load
+ * of the unmodified driver state machine for different numbers of modules.
+ *
+ * Besides ltc_pec, the module only uses the time base of the mcu module (MCU_GetTimeStamp(),
+ * MCU_GetTimeBase() and the SysTick reload value), so it can also be compiled for a host
+ * by providing these.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_sim.h"
+
+#include "mcu.h"
+#include "ltc_pec.h"
+
+#if LTC_SIMULATION == TRUE
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * Command codes (11 bit) of the LTC6804, RDCVE/F only exist on the LTC6813
+ */
+#define LTC_SIM_CMD_WRCFG       0x001
+#define LTC_SIM_CMD_RDCFG       0x002
+#define LTC_SIM_CMD_RDCVA       0x004
+#define LTC_SIM_CMD_RDCVB       0x006
+#define LTC_SIM_CMD_RDCVC       0x008
+#define LTC_SIM_CMD_RDCVD       0x00A
+#define LTC_SIM_CMD_RDCVE       0x009
+#define LTC_SIM_CMD_RDCVF       0x00B
+#define LTC_SIM_CMD_RDAUXA      0x00C
+#define LTC_SIM_CMD_RDAUXB      0x00E
+#define LTC_SIM_CMD_WRCOMM      0x721
+#define LTC_SIM_CMD_RDCOMM      0x722
+#define LTC_SIM_CMD_STCOMM      0x723
+
+/**
+ * ICOM code for an I2C START condition in the COMM register
+ */
+#define LTC_SIM_ICOM_START      0x60
+
+/**
+ * ADCV: 0 1 MD[1] MD[0] 1 1 DCP 0 CH[2] CH[1] CH[0]
+ */
+#define LTC_SIM_CMD_ADCV_MASK   0x668
+#define LTC_SIM_CMD_ADCV        0x260
+
+/**
+ * ADAX: 1 0 MD[1] MD[0] 1 1 0 0 CHG[2] CHG[1] CHG[0]
+ */
+#define LTC_SIM_CMD_ADAX_MASK   0x678
+#define LTC_SIM_CMD_ADAX        0x460
+
+/**
+ * ADCVAX: 1 0 MD[1] MD[0] 1 1 DCP 1 1 1 1
+ */
+#define LTC_SIM_CMD_ADCVAX_MASK 0x66F
+#define LTC_SIM_CMD_ADCVAX      0x46F
+
+/**
+ * Number of cell voltage and auxiliary registers (16 bit) per device
+ */
+#define LTC_SIM_N_CELLREGISTERS LTC_N_CELLS_PER_LTC
+#define LTC_SIM_N_AUXREGISTERS  6
+
+/**
+ * GPIO the output of a multiplexer is connected to (0: GPIO1)
+ */
+#if LTC_MUX_MULTI_GPIO == TRUE
+#define LTC_SIM_MUX_GPIO(mux)   (ltc_mux_gpio_cfg[(mux)])
+#else
+#define LTC_SIM_MUX_GPIO(mux)   0
+#endif
+
+/**
+ * Value of a result register that has not been converted yet
+ */
+#define LTC_SIM_REGISTER_CLEARED    0xFFFF
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * State of one simulated device of the daisy-chain
+ */
+typedef struct {
+    uint16_t cellvoltage[LTC_SIM_N_CELLREGISTERS];  /*!< cell voltage registers, unit 100uV                     */
+    uint16_t auxvoltage[LTC_SIM_N_AUXREGISTERS];    /*!< GPIO1-5 and REF registers, unit 100uV                  */
+    uint8_t cfg[6];                                 /*!< configuration register group                           */
+    uint8_t comm[6];                                /*!< COMM register group                                    */
+    uint8_t muxch[LTC_N_MUX_PER_LTC];               /*!< selected channel per multiplexer, 0xFF if switched off */
+} LTC_SIM_DEVICE_s;
+
+static LTC_SIM_DEVICE_s ltc_sim_devices[LTC_N_LTC];
+static LTC_SIM_STATISTICS_s ltc_sim_statistics;
+
+static uint8_t ltc_sim_initialized = FALSE;
+static uint32_t ltc_sim_lastframe_us = 0;
+static uint32_t ltc_sim_lastcommand_us = 0;
+static uint32_t ltc_sim_cellconversion_end_us = 0;
+static uint32_t ltc_sim_auxconversion_end_us = 0;
+static uint32_t ltc_sim_conversioncounter = 0;
+#if LTC_SIM_PEC_ERROR_INTERVAL > 0
+static uint32_t ltc_sim_readcounter = 0;
+#endif
+
+static uint32_t ltc_sim_benchmark_start_us = 0;
+static uint32_t ltc_sim_benchmark_cputime_us = 0;
+static uint32_t ltc_sim_benchmark_cyclestart_ms = 0;
+
+/*================== Function Prototypes ==================================*/
+static uint32_t LTC_SIM_GetTime_us(void);
+static void LTC_SIM_ResetDevice(LTC_SIM_DEVICE_s *device);
+static void LTC_SIM_ResetDaisyChain(void);
+static uint8_t LTC_SIM_WakeUp(uint32_t now_us);
+static uint8_t LTC_SIM_CheckPEC(uint8_t *data, uint8_t len);
+static void LTC_SIM_WriteRegisterGroup(uint16_t command, uint8_t *pData, uint16_t Size);
+static void LTC_SIM_ReadRegisterGroup(uint16_t command, uint8_t *pRxData, uint16_t Size);
+static void LTC_SIM_StartCellConversion(uint16_t command);
+static void LTC_SIM_StartAuxConversion(uint16_t command);
+static void LTC_SIM_StartCombinedConversion(uint16_t command);
+static void LTC_SIM_I2CTransmission(LTC_SIM_DEVICE_s *device);
+static uint16_t LTC_SIM_GetMuxVoltage(uint16_t deviceIndex, LTC_SIM_DEVICE_s *device, uint8_t gpio);
+static uint32_t LTC_SIM_GetConversionTime_us(uint8_t md, uint8_t singleChannel, uint8_t conversionsPerADC);
+static uint8_t LTC_SIM_Timeout(uint32_t end_us);
+
+/*================== Function Implementations =============================*/
+
+/*================== Public functions =====================================*/
+
+void LTC_SIM_Init(void) {
+
+    LTC_SIM_ResetDaisyChain();
+    // the daisy-chain is asleep after power-on
+    ltc_sim_lastframe_us = LTC_SIM_GetTime_us() - LTC_TSLEEP_US - 1;
+    ltc_sim_lastcommand_us = ltc_sim_lastframe_us;
+
+    ltc_sim_statistics.frames = 0;
+    ltc_sim_statistics.bytes = 0;
+    ltc_sim_statistics.wakeupframes = 0;
+    ltc_sim_statistics.commandpecerrors = 0;
+    ltc_sim_statistics.datapecerrors = 0;
+    ltc_sim_statistics.prematurereads = 0;
+    ltc_sim_statistics.cycles = 0;
+    ltc_sim_statistics.cycletime_ms = 0;
+    ltc_sim_statistics.cycletime_ms_min = 0xFFFFFFFF;
+    ltc_sim_statistics.cycletime_ms_max = 0;
+    ltc_sim_statistics.cputime_us = 0;
+    ltc_sim_statistics.cputime_us_min = 0xFFFFFFFF;
+    ltc_sim_statistics.cputime_us_max = 0;
+
+    ltc_sim_conversioncounter = 0;
+#if LTC_SIM_PEC_ERROR_INTERVAL > 0
+    ltc_sim_readcounter = 0;
+#endif
+    ltc_sim_benchmark_cputime_us = 0;
+    ltc_sim_benchmark_cyclestart_ms = MCU_GetTimeStamp();
+    ltc_sim_initialized = TRUE;
+}
+
+
+STD_RETURN_TYPE_e LTC_SIM_Transmit(uint8_t *pData, uint16_t Size) {
+
+    uint32_t now_us = 0;
+    uint16_t command = 0;
+
+    if (ltc_sim_initialized == FALSE) {
+        LTC_SIM_Init();
+    }
+
+    now_us = LTC_SIM_GetTime_us();
+    ltc_sim_statistics.frames++;
+    ltc_sim_statistics.bytes += Size;
+
+    if (LTC_SIM_WakeUp(now_us) == TRUE) {
+        return E_OK;
+    }
+
+    if ((Size < 4) || (pData[0] == 0xFF)) {
+        return E_OK;    // dummy bytes, no command starts with 0xFF
+    }
+
+    if (LTC_SIM_CheckPEC(pData, 2) == FALSE) {
+        ltc_sim_statistics.commandpecerrors++;
+        return E_OK;
+    }
+    ltc_sim_lastcommand_us = now_us;    // a valid command resets the watchdog
+
+    command = ((pData[0] << 8) | pData[1]) & 0x7FF;
+
+    if ((command & LTC_SIM_CMD_ADCV_MASK) == LTC_SIM_CMD_ADCV) {
+        LTC_SIM_StartCellConversion(command);
+    }
+    else if ((command & LTC_SIM_CMD_ADAX_MASK) == LTC_SIM_CMD_ADAX) {
+        LTC_SIM_StartAuxConversion(command);
+    }
+    else if ((command & LTC_SIM_CMD_ADCVAX_MASK) == LTC_SIM_CMD_ADCVAX) {
+        LTC_SIM_StartCombinedConversion(command);
+    }
+    else if (command == LTC_SIM_CMD_STCOMM) {
+        for (uint16_t i=0; i < LTC_N_LTC; i++) {
+            LTC_SIM_I2CTransmission(&ltc_sim_devices[i]);
+        }
+    }
+    else if (command == LTC_SIM_CMD_WRCFG || command == LTC_SIM_CMD_WRCOMM) {
+        LTC_SIM_WriteRegisterGroup(command, pData, Size);
+    }
+
+    return E_OK;
+}
+
+
+STD_RETURN_TYPE_e LTC_SIM_TransmitReceive(uint8_t *pTxData, uint8_t *pRxData, uint16_t Size) {
+
+    uint16_t i = 0;
+    uint16_t command = 0;
+    uint32_t now_us = 0;
+
+    for (i=0; i < Size; i++) {
+        pRxData[i] = 0xFF;
+    }
+
+    if (ltc_sim_initialized == FALSE) {
+        LTC_SIM_Init();
+    }
+
+    now_us = LTC_SIM_GetTime_us();
+    ltc_sim_statistics.frames++;
+    ltc_sim_statistics.bytes += Size;
+
+    if (LTC_SIM_WakeUp(now_us) == TRUE) {
+        return E_OK;
+    }
+
+    if (Size < 4 || LTC_SIM_CheckPEC(pTxData, 2) == FALSE) {
+        ltc_sim_statistics.commandpecerrors++;
+        return E_OK;
+    }
+    ltc_sim_lastcommand_us = now_us;    // a valid command resets the watchdog
+
+    command = ((pTxData[0] << 8) | pTxData[1]) & 0x7FF;
+    LTC_SIM_ReadRegisterGroup(command, pRxData, Size);
+
+    return E_OK;
+}
+
+
+uint32_t LTC_SIM_GetIdleTime_us(void) {
+    return LTC_SIM_GetTime_us() - ltc_sim_lastframe_us;
+}
+
+
+void LTC_SIM_BenchmarkStart(void) {
+    ltc_sim_benchmark_start_us = LTC_SIM_GetTime_us();
+}
+
+
+void LTC_SIM_BenchmarkStop(void) {
+    ltc_sim_benchmark_cputime_us += LTC_SIM_GetTime_us() - ltc_sim_benchmark_start_us;
+}
+
+
+void LTC_SIM_BenchmarkCycleFinished(void) {
+
+    uint32_t now_ms = MCU_GetTimeStamp();
+
+    if (ltc_sim_initialized == FALSE) {
+        LTC_SIM_Init();
+    }
+
+    ltc_sim_statistics.cycles++;
+    ltc_sim_statistics.cycletime_ms = now_ms - ltc_sim_benchmark_cyclestart_ms;
+    ltc_sim_statistics.cputime_us = ltc_sim_benchmark_cputime_us;
+
+    // first cycle contains the initialization of the daisy-chain
+    if (ltc_sim_statistics.cycles > 1) {
+        if (ltc_sim_statistics.cycletime_ms < ltc_sim_statistics.cycletime_ms_min) {
+            ltc_sim_statistics.cycletime_ms_min = ltc_sim_statistics.cycletime_ms;
+        }
+        if (ltc_sim_statistics.cycletime_ms > ltc_sim_statistics.cycletime_ms_max) {
+            ltc_sim_statistics.cycletime_ms_max = ltc_sim_statistics.cycletime_ms;
+        }
+        if (ltc_sim_statistics.cputime_us < ltc_sim_statistics.cputime_us_min) {
+            ltc_sim_statistics.cputime_us_min = ltc_sim_statistics.cputime_us;
+        }
+        if (ltc_sim_statistics.cputime_us > ltc_sim_statistics.cputime_us_max) {
+            ltc_sim_statistics.cputime_us_max = ltc_sim_statistics.cputime_us;
+        }
+    }
+
+    ltc_sim_benchmark_cyclestart_ms = now_ms;
+    ltc_sim_benchmark_cputime_us = 0;
+}
+
+
+const LTC_SIM_STATISTICS_s *LTC_SIM_GetStatistics(void) {
+    return &ltc_sim_statistics;
+}
+
+/*================== Static functions =====================================*/
+
+/**
+ * @brief   gets the system time in us.
+ *
+ * Combines the 1ms kernel tick with the SysTick down-counter. The counter is read twice
+ * to detect a tick overflow between both reads.
+ *
+ * @return  time in us
+ */
+static uint32_t LTC_SIM_GetTime_us(void) {
+
+    uint32_t ticks_ms = 0;
+    uint32_t counter = 0;
+    uint32_t counter_check = 0;
+    uint32_t reload = 0;
+
+    counter = MCU_GetTimeBase();
+    ticks_ms = MCU_GetTimeStamp();
+    counter_check = MCU_GetTimeBase();
+    if (counter_check > counter) {
+        // SysTick reloaded between both reads
+        ticks_ms = MCU_GetTimeStamp();
+        counter = counter_check;
+    }
+
+    reload = SysTick->LOAD + 1;
+
+    return (ticks_ms*1000 + ((reload - 1 - counter)*1000)/reload);
+}
+
+
+/**
+ * @brief   returns TRUE if the given time in us has been reached.
+ *
+ * @param   end_us      time to compare with the current time
+ *
+ * @return  TRUE if end_us is reached, FALSE otherwise
+ */
+static uint8_t LTC_SIM_Timeout(uint32_t end_us) {
+    return ((int32_t)(LTC_SIM_GetTime_us() - end_us) >= 0) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief   puts a simulated device in its power-on state.
+ *
+ * @param   *device     device to reset
+ *
+ * @return  void
+ */
+static void LTC_SIM_ResetDevice(LTC_SIM_DEVICE_s *device) {
+
+    uint8_t i = 0;
+
+    for (i=0; i < LTC_SIM_N_CELLREGISTERS; i++) {
+        device->cellvoltage[i] = LTC_SIM_REGISTER_CLEARED;
+    }
+    for (i=0; i < LTC_SIM_N_AUXREGISTERS; i++) {
+        device->auxvoltage[i] = LTC_SIM_REGISTER_CLEARED;
+    }
+    for (i=0; i < 6; i++) {
+        device->cfg[i] = 0x00;
+        device->comm[i] = 0x00;
+    }
+    for (i=0; i < LTC_N_MUX_PER_LTC; i++) {
+        device->muxch[i] = 0xFF;
+    }
+}
+
+
+/**
+ * @brief   puts all simulated devices in their power-on state.
+ *
+ * @return  void
+ */
+static void LTC_SIM_ResetDaisyChain(void) {
+
+    uint16_t i = 0;
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        LTC_SIM_ResetDevice(&ltc_sim_devices[i]);
+    }
+    ltc_sim_cellconversion_end_us = LTC_SIM_GetTime_us();
+    ltc_sim_auxconversion_end_us = ltc_sim_cellconversion_end_us;
+}
+
+
+/**
+ * @brief   handles the wake-up of the daisy-chain.
+ *
+ * If the time since the last frame is longer than LTC_TIDLE_US, the isoSPI ports are idle
+ * and the frame is only used to wake them up. If the time since the last valid command is
+ * longer than LTC_TSLEEP_US, the watchdog has put the devices to sleep: they lost their
+ * configuration and the frame is only used to wake them up. Dummy bytes do not reset the watchdog.
+ *
+ * @param   now_us      time at which the frame is received
+ *
+ * @return  TRUE if the content of the frame is discarded, FALSE otherwise
+ */
+static uint8_t LTC_SIM_WakeUp(uint32_t now_us) {
+
+    uint32_t idletime_us = now_us - ltc_sim_lastframe_us;
+    uint8_t asleep = FALSE;
+
+    ltc_sim_lastframe_us = now_us;
+
+    if ((now_us - ltc_sim_lastcommand_us) > LTC_TSLEEP_US) {
+        LTC_SIM_ResetDaisyChain();
+        ltc_sim_lastcommand_us = now_us;    // woken up, the watchdog starts again
+        asleep = TRUE;
+    }
+    if ((asleep == TRUE) || (idletime_us > LTC_TIDLE_US)) {
+        ltc_sim_statistics.wakeupframes++;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+
+/**
+ * @brief   checks the PEC following a block of data.
+ *
+ * @param   *data       data followed by two bytes of PEC
+ * @param   len         number of data bytes
+ *
+ * @return  TRUE if the PEC is correct, FALSE otherwise
+ */
+static uint8_t LTC_SIM_CheckPEC(uint8_t *data, uint8_t len) {
+
+    uint16_t PEC_result = LTC_pec15_calc(len, data);
+
+    if ( (data[len] != (uint8_t)((PEC_result>>8)&0xff)) || (data[len+1] != (uint8_t)(PEC_result&0xff)) ) {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+
+/**
+ * @brief   writes a register group of all devices.
+ *
+ * The data shifted in first ends up in the last device of the daisy-chain.
+ * Devices receiving a wrong PEC ignore the write.
+ *
+ * @param   command     write command (WRCFG or WRCOMM)
+ * @param   *pData      frame with command, PEC and register data
+ * @param   Size        size of the frame
+ *
+ * @return  void
+ */
+static void LTC_SIM_WriteRegisterGroup(uint16_t command, uint8_t *pData, uint16_t Size) {
+
+    uint16_t i = 0;
+    uint8_t j = 0;
+    uint8_t *data = NULL_PTR;
+    LTC_SIM_DEVICE_s *device = NULL_PTR;
+
+    for (i=0; i < LTC_N_LTC; i++) {
+
+        if (4+(i+1)*8 > Size) {
+            break;
+        }
+
+        data = &pData[4+i*8];
+        device = &ltc_sim_devices[LTC_N_LTC-1-i];
+
+        if (LTC_SIM_CheckPEC(data, 6) == FALSE) {
+            ltc_sim_statistics.datapecerrors++;
+            continue;
+        }
+
+        for (j=0; j < 6; j++) {
+            if (command == LTC_SIM_CMD_WRCFG) {
+                device->cfg[j] = data[j];
+            }
+            else {
+                device->comm[j] = data[j];
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief   reads a register group of all devices.
+ *
+ * The data of the first device in the daisy-chain is shifted out first.
+ * Result registers read before the end of a conversion contain 0xFF.
+ *
+ * @param   command     read command
+ * @param   *pRxData    buffer for the answer of the daisy-chain
+ * @param   Size        size of the frame
+ *
+ * @return  void
+ */
+static void LTC_SIM_ReadRegisterGroup(uint16_t command, uint8_t *pRxData, uint16_t Size) {
+
+    uint16_t i = 0;
+    uint8_t j = 0;
+    uint16_t PEC_result = 0;
+    uint8_t *data = NULL_PTR;
+    uint16_t *registers = NULL_PTR;
+    LTC_SIM_DEVICE_s *device = NULL_PTR;
+    uint8_t converting = FALSE;
+
+    if (command == LTC_SIM_CMD_RDCVA || command == LTC_SIM_CMD_RDCVB || command == LTC_SIM_CMD_RDCVC ||
+        command == LTC_SIM_CMD_RDCVD || command == LTC_SIM_CMD_RDCVE || command == LTC_SIM_CMD_RDCVF) {
+        converting = (LTC_SIM_Timeout(ltc_sim_cellconversion_end_us) == TRUE) ? FALSE : TRUE;
+    }
+    else if (command == LTC_SIM_CMD_RDAUXA || command == LTC_SIM_CMD_RDAUXB) {
+        converting = (LTC_SIM_Timeout(ltc_sim_auxconversion_end_us) == TRUE) ? FALSE : TRUE;
+    }
+    else if (command != LTC_SIM_CMD_RDCFG && command != LTC_SIM_CMD_RDCOMM) {
+        return;     // no read command
+    }
+
+    if (converting == TRUE) {
+        ltc_sim_statistics.prematurereads++;
+    }
+
+    for (i=0; i < LTC_N_LTC; i++) {
+
+        if (4+(i+1)*8 > Size) {
+            break;
+        }
+
+        data = &pRxData[4+i*8];
+        device = &ltc_sim_devices[i];
+        registers = NULL_PTR;
+
+        switch (command) {
+            case LTC_SIM_CMD_RDCVA:
+                registers = &device->cellvoltage[0];
+                break;
+            case LTC_SIM_CMD_RDCVB:
+                registers = &device->cellvoltage[3];
+                break;
+            case LTC_SIM_CMD_RDCVC:
+                registers = &device->cellvoltage[6];
+                break;
+            case LTC_SIM_CMD_RDCVD:
+                registers = &device->cellvoltage[9];
+                break;
+#if LTC_SIM_N_CELLREGISTERS > 12
+            case LTC_SIM_CMD_RDCVE:
+                registers = &device->cellvoltage[12];
+                break;
+            case LTC_SIM_CMD_RDCVF:
+                registers = &device->cellvoltage[15];
+                break;
+#endif
+            case LTC_SIM_CMD_RDAUXA:
+                registers = &device->auxvoltage[0];
+                break;
+            case LTC_SIM_CMD_RDAUXB:
+                registers = &device->auxvoltage[3];
+                break;
+            case LTC_SIM_CMD_RDCFG:
+                for (j=0; j < 6; j++) {
+                    data[j] = device->cfg[j];
+                }
+                break;
+            case LTC_SIM_CMD_RDCOMM:
+                // slave acknowledged every byte, the R/W bit of the address is read back as 0
+                data[0] = device->comm[0];
+                data[1] = (device->comm[1] & 0xE0) | 0x07;
+                data[2] = device->comm[2];
+                data[3] = (device->comm[3] & 0xF0) | 0x07;
+                data[4] = device->comm[4];
+                data[5] = device->comm[5];
+                break;
+            default:
+                break;
+        }
+
+        if (registers != NULL_PTR) {
+            for (j=0; j < 3; j++) {
+                if (converting == TRUE) {
+                    data[2*j] = 0xFF;
+                    data[2*j+1] = 0xFF;
+                }
+                else {
+                    data[2*j] = (uint8_t)(registers[j] & 0xFF);
+                    data[2*j+1] = (uint8_t)(registers[j] >> 8);
+                }
+            }
+        }
+
+        PEC_result = LTC_pec15_calc(6, data);
+        data[6] = (uint8_t)((PEC_result>>8)&0xff);
+        data[7] = (uint8_t)(PEC_result&0xff);
+
+#if LTC_SIM_PEC_ERROR_INTERVAL > 0
+        if (++ltc_sim_readcounter >= LTC_SIM_PEC_ERROR_INTERVAL) {
+            // inject a single bit error
+            ltc_sim_readcounter = 0;
+            data[ltc_sim_conversioncounter % 6] ^= 0x04;
+        }
+#endif
+    }
+}
+
+
+/**
+ * @brief   gets the conversion time of the devices.
+ *
+ * The conversion time of all channels is given for 12 cells (4 conversions per ADC).
+ * It is scaled with the number of conversions per ADC for more cells or a combined conversion.
+ *
+ * @param   md              value of the MD bits of the conversion command
+ * @param   singleChannel   TRUE if a single channel is converted
+ * @param   conversionsPerADC   number of conversions of each of the 3 ADCs (not used for a single channel)
+ *
+ * @return  conversion time in us
+ */
+static uint32_t LTC_SIM_GetConversionTime_us(uint8_t md, uint8_t singleChannel, uint8_t conversionsPerADC) {
+
+    uint32_t retVal = 0;
+
+    if (md == 1) {
+        retVal = (singleChannel == TRUE) ? LTC_SIM_TCYCLE_SINGLE_FAST_US : LTC_SIM_TCYCLE_ALL_FAST_US;
+    }
+    else if (md == 3) {
+        retVal = (singleChannel == TRUE) ? LTC_SIM_TCYCLE_SINGLE_FILTERED_US : LTC_SIM_TCYCLE_ALL_FILTERED_US;
+    }
+    else {
+        retVal = (singleChannel == TRUE) ? LTC_SIM_TCYCLE_SINGLE_NORMAL_US : LTC_SIM_TCYCLE_ALL_NORMAL_US;
+    }
+
+    if (singleChannel == FALSE) {
+        retVal = retVal*conversionsPerADC/4;
+    }
+
+    return retVal;
+}
+
+
+/**
+ * @brief   starts a cell voltage conversion (ADCV) on all devices.
+ *
+ * The simulated voltages are spread around LTC_SIM_CELLVOLTAGE_MV and change with
+ * every conversion, so minimum and maximum move through the battery pack.
+ *
+ * @param   command     ADCV command
+ *
+ * @return  void
+ */
+static void LTC_SIM_StartCellConversion(uint16_t command) {
+
+    uint16_t i = 0;
+    uint8_t j = 0;
+    uint8_t md = (command >> 7) & 0x03;
+    int32_t voltage_mV = 0;
+
+    ltc_sim_conversioncounter++;
+    ltc_sim_cellconversion_end_us = LTC_SIM_GetTime_us() + LTC_SIM_GetConversionTime_us(md, FALSE, LTC_SIM_N_CELLREGISTERS/3);
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        for (j=0; j < LTC_SIM_N_CELLREGISTERS; j++) {
+            voltage_mV = LTC_SIM_CELLVOLTAGE_MV + (int32_t)((i*7 + j*3 + ltc_sim_conversioncounter) % 16) - 8;
+            ltc_sim_devices[i].cellvoltage[j] = (uint16_t)(voltage_mV*10);
+        }
+    }
+}
+
+
+/**
+ * @brief   starts a GPIO conversion (ADAX) on all devices.
+ *
+ * GPIOs with multiplexers get the voltage of the currently selected multiplexer input
+ * (only GPIO1 without LTC_MUX_MULTI_GPIO), the other GPIOs constant voltages and REF the
+ * 3V reference.
+ *
+ * @param   command     ADAX command
+ *
+ * @return  void
+ */
+static void LTC_SIM_StartAuxConversion(uint16_t command) {
+
+    uint16_t i = 0;
+    uint8_t j = 0;
+    uint8_t md = (command >> 7) & 0x03;
+    uint8_t chg = command & 0x07;
+
+    ltc_sim_auxconversion_end_us = LTC_SIM_GetTime_us() + LTC_SIM_GetConversionTime_us(md, (chg != 0) ? TRUE : FALSE, 4);
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        for (j=0; j < 5; j++) {
+            if (chg == 0 || chg == j+1) {
+                ltc_sim_devices[i].auxvoltage[j] = LTC_SIM_GetMuxVoltage(i, &ltc_sim_devices[i], j);
+            }
+        }
+        if (chg == 0) {
+            ltc_sim_devices[i].auxvoltage[5] = 30000;
+        }
+    }
+}
+
+
+/**
+ * @brief   starts a combined cell and GPIO1/2 conversion (ADCVAX) on all devices.
+ *
+ * The cell voltage registers are converted as with ADCV, GPIO1 gets the voltage of the
+ * currently selected multiplexer input. Cell and auxiliary results are available at the
+ * end of the combined conversion.
+ *
+ * @param   command     ADCVAX command
+ *
+ * @return  void
+ */
+static void LTC_SIM_StartCombinedConversion(uint16_t command) {
+
+    uint16_t i = 0;
+    uint8_t md = (command >> 7) & 0x03;
+
+    // cell registers and conversion counter as for ADCV
+    LTC_SIM_StartCellConversion(command);
+    ltc_sim_cellconversion_end_us = LTC_SIM_GetTime_us() + LTC_SIM_GetConversionTime_us(md, FALSE, LTC_SIM_N_CELLREGISTERS/3 + 2);
+    ltc_sim_auxconversion_end_us = ltc_sim_cellconversion_end_us;
+
+    for (i=0; i < LTC_N_LTC; i++) {
+        ltc_sim_devices[i].auxvoltage[0] = LTC_SIM_GetMuxVoltage(i, &ltc_sim_devices[i], 0);
+        ltc_sim_devices[i].auxvoltage[1] = LTC_SIM_GetMuxVoltage(i, &ltc_sim_devices[i], 1);
+    }
+}
+
+
+/**
+ * @brief   gets the voltage at a GPIO of a device.
+ *
+ * Temperature multiplexers (0 and 1) return a voltage depending on the channel,
+ * balancing feedback multiplexers (2 and 3) return 3V if the balancing of the
+ * corresponding cell is switched on in the configuration register.
+ * GPIOs without multiplexer return a constant voltage.
+ *
+ * @param   deviceIndex     index of the device (0 to LTC_N_LTC-1)
+ * @param   *device         simulated device
+ * @param   gpio            GPIO (0: GPIO1)
+ *
+ * @return  voltage in 100uV
+ */
+static uint16_t LTC_SIM_GetMuxVoltage(uint16_t deviceIndex, LTC_SIM_DEVICE_s *device, uint8_t gpio) {
+
+    uint8_t mux = 0;
+    uint8_t cell = 0;
+    uint8_t connected = FALSE;
+    uint16_t dcc = (device->cfg[4]) | ((device->cfg[5] & 0x0F) << 8);
+
+    for (mux=0; mux < LTC_N_MUX_PER_LTC; mux++) {
+
+        if (LTC_SIM_MUX_GPIO(mux) != gpio) {
+            continue;   // multiplexer on another GPIO
+        }
+        connected = TRUE;
+        if (device->muxch[mux] >= LTC_N_MUX_CHANNELS_PER_MUX) {
+            continue;   // multiplexer switched off
+        }
+
+        if (mux <= 1) {
+            return (uint16_t)(15000 + (deviceIndex % 10)*100 + (mux*8 + device->muxch[mux])*50);
+        }
+
+        cell = (mux-2)*8 + device->muxch[mux];
+        return ((dcc >> cell) & 0x01) ? 30000 : 0;
+    }
+
+    if (connected == FALSE) {
+        return 10000 + gpio*1000;
+    }
+    return 0;   // output of all multiplexers is high impedance
+}
+
+
+/**
+ * @brief   executes the I2C transmission stored in the COMM register of a device.
+ *
+ * Only the frame used by the driver is decoded: START, address byte, data byte, STOP.
+ * The lower two bits of the I2C address select the multiplexer.
+ *
+ * @param   *device     simulated device
+ *
+ * @return  void
+ */
+static void LTC_SIM_I2CTransmission(LTC_SIM_DEVICE_s *device) {
+
+    uint8_t address = 0;
+    uint8_t data = 0;
+    uint8_t mux = 0;
+    uint8_t channel = 0xFF;
+
+    if ((device->comm[0] & 0xF0) != LTC_SIM_ICOM_START) {
+        return;
+    }
+
+    address = (((device->comm[0] & 0x0F) << 4) | (device->comm[1] >> 4)) >> 1;
+    data = ((device->comm[2] & 0x0F) << 4) | (device->comm[3] >> 4);
+    mux = address & 0x03;
+
+    if (mux >= LTC_N_MUX_PER_LTC) {
+        return;
+    }
+
+#if SLAVE_BOARD_VERSION == 2
+    // ADG728: one bit per channel
+    for (uint8_t i=0; i < LTC_N_MUX_CHANNELS_PER_MUX; i++) {
+        if (data & (1 << i)) {
+            channel = i;
+            break;
+        }
+    }
+#else
+    // LTC1380: enable bit and channel number
+    if (data & 0x80) {
+        channel = data & 0x07;
+    }
+#endif
+
+    device->muxch[mux] = channel;
+}
+
+#endif /* LTC_SIMULATION == TRUE */
@@ -0,0 +1,148 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_sim.h
+ * @author  foxBMS Team
+ * @date    16.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_SIM
+ *
+ * @brief   Headers for the simulated LTC6804 daisy-chain.
+ *
+ */
+
+#ifndef LTC_SIM_H_
+#define LTC_SIM_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/**
+ * Benchmark and traffic statistics of the simulated daisy-chain.
+ * A measurement cycle is one pass through the ltc_taskcycle sequence of LTC_Ctrl().
+ */
+typedef struct {
+    uint32_t frames;                /*!< number of SPI frames sent to the simulated daisy-chain                             */
+    uint32_t bytes;                 /*!< number of bytes sent to the simulated daisy-chain                                  */
+    uint32_t wakeupframes;          /*!< frames that were only used to wake up the isoSPI port (content discarded)          */
+    uint32_t commandpecerrors;      /*!< frames ignored because of a wrong command PEC                                      */
+    uint32_t datapecerrors;         /*!< register writes ignored because of a wrong data PEC                                */
+    uint32_t prematurereads;        /*!< result registers read before the conversion was finished                          */
+    uint32_t cycles;                /*!< number of completed measurement cycles                                             */
+    uint32_t cycletime_ms;          /*!< duration of the last measurement cycle in ms                                       */
+    uint32_t cycletime_ms_min;      /*!< minimum duration of a measurement cycle in ms                                      */
+    uint32_t cycletime_ms_max;      /*!< maximum duration of a measurement cycle in ms                                      */
+    uint32_t cputime_us;            /*!< CPU time spent in LTC_Ctrl() and LTC_Trigger() during the last cycle in us         */
+    uint32_t cputime_us_min;        /*!< minimum CPU time per measurement cycle in us                                       */
+    uint32_t cputime_us_max;        /*!< maximum CPU time per measurement cycle in us                                       */
+} LTC_SIM_STATISTICS_s;
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   resets the simulated daisy-chain.
+ *
+ * All simulated devices are put back to their power-on state and the statistics are cleared.
+ * The simulation initializes itself on the first transmission, so calling this function is only
+ * needed to restart a benchmark.
+ *
+ * @return  void
+ */
+extern void LTC_SIM_Init(void);
+
+/**
+ * @brief   sends a frame to the simulated daisy-chain.
+ *
+ * Replacement for SPI_QueueTransmit() when LTC_SIMULATION is enabled.
+ *
+ * @param   *pData      data to be sent (command, PEC and optional register data)
+ * @param   Size        size of the data to be sent
+ *
+ * @return  E_OK (the simulated transmission never fails)
+ */
+extern STD_RETURN_TYPE_e LTC_SIM_Transmit(uint8_t *pData, uint16_t Size);
+
+/**
+ * @brief   sends a frame to the simulated daisy-chain and receives its answer.
+ *
+ * Replacement for SPI_QueueTransmitReceive() when LTC_SIMULATION is enabled.
+ * The first 4 bytes of pRxData are set to 0xFF (no data during command), the following bytes
+ * contain 6 data bytes and 2 PEC bytes per device, first device of the daisy-chain first.
+ *
+ * @param   *pTxData    data to be sent
+ * @param   *pRxData    data to be received
+ * @param   Size        size of the data to be sent/received
+ *
+ * @return  E_OK (the simulated transmission never fails)
+ */
+extern STD_RETURN_TYPE_e LTC_SIM_TransmitReceive(uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+
+/**
+ * @brief   gets the time since the last frame received by the simulated daisy-chain.
+ *
+ * Replacement for SPI_GetIdleTime_us() when LTC_SIMULATION is enabled.
+ *
+ * @return  time since the last frame in us
+ */
+extern uint32_t LTC_SIM_GetIdleTime_us(void);
+
+/**
+ * @brief   marks the start of the LTC driver calls in the 1ms task.
+ *
+ * Together with LTC_SIM_BenchmarkStop(), measures the CPU time spent in the LTC driver.
+ *
+ * @return  void
+ */
+extern void LTC_SIM_BenchmarkStart(void);
+
+/**
+ * @brief   marks the end of the LTC driver calls in the 1ms task.
+ *
+ * @return  void
+ */
+extern void LTC_SIM_BenchmarkStop(void);
+
+/**
+ * @brief   marks the end of a measurement cycle.
+ *
+ * Called by LTC_Ctrl() when the ltc_taskcycle sequence restarts. Updates the cycle time and the
+ * CPU time per cycle in the statistics.
+ *
+ * @return  void
+ */
+extern void LTC_SIM_BenchmarkCycleFinished(void);
+
+/**
+ * @brief   gets the statistics of the simulated daisy-chain.
+ *
+ * @return  pointer to the statistics
+ */
+extern const LTC_SIM_STATISTICS_s *LTC_SIM_GetStatistics(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_SIM_H_ */
@@ -0,0 +1,251 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_spiclk.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_SPICLK
+ *
+ * @brief   Adaptation of the SPI clock of the LTC daisy-chain to its PEC error rate.
+ *
+ * The reliable SPI clock of a daisy-chain depends on its cabling. The daisy-chain starts with the
+ * prescaler configured in spi_devices[]. The PEC checked frames are evaluated in windows of
+ * LTC_SPICLK_WINDOW frames: a window with LTC_SPICLK_ERRORS_SLOWER or more erroneous frames slows
+ * the clock down by one prescaler step, LTC_SPICLK_CLEAN_WINDOWS windows without error speed it up
+ * by one step. If the faster clock fails already in its first window, the number of clean windows
+ * needed for the next attempt is doubled, so that a daisy-chain at its limit does not toggle
+ * between two clocks.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_spiclk.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * number of prescaler steps of the STM32 SPI (fPCLK/2 to fPCLK/256)
+ */
+#define LTC_SPICLK_N_PRESCALERS     8
+
+/**
+ * the prescaler setup bits are the bits 5:3 of the SPI_CR1 register (reference manual p.909)
+ */
+#define LTC_SPICLK_BR_POSITION      3
+
+/**
+ * adaptation state of the SPI clock
+ */
+typedef struct {
+    uint8_t prescaler;              /*!< prescaler setup bits, 0: fPCLK/2 ... 7: fPCLK/256   */
+    uint8_t fastest;                /*!< lowest allowed prescaler setup bits                 */
+    uint8_t slowest;                /*!< highest allowed prescaler setup bits                */
+    uint8_t probing;                /*!< TRUE during the first window after a speed up       */
+    uint16_t frames;                /*!< frames in the current window                        */
+    uint16_t errorFrames;           /*!< frames with PEC error in the current window         */
+    uint16_t cleanWindows;          /*!< consecutive windows without PEC error               */
+    uint16_t cleanWindowsNeeded;    /*!< clean windows needed for the next speed up          */
+} LTC_SPICLK_STATE_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+static LTC_SPICLK_STATE_s ltc_spiclk_state;
+static uint8_t ltc_spiclk_pending = FALSE;
+static uint8_t ltc_spiclk_initialized = FALSE;
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+static uint32_t LTC_SPICLK_GetPCLK(SPI_HandleTypeDef *hspi);
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+static void LTC_SPICLK_EndWindow(LTC_SPICLK_STATE_s *state, uint8_t slower);
+#endif
+
+/*================== Function Implementations =============================*/
+
+uint32_t LTC_SPICLK_GetFrequency(SPI_HandleTypeDef *hspi) {
+
+    // Division are made by powers of 2 which corresponds to shifting to the right
+    // Then 0 corresponds to divide by 2, 1 corresponds to divide by 4... so 1 has to be added to the value of the configuration bits
+    return LTC_SPICLK_GetPCLK(hspi)>>( (hspi->Init.BaudRatePrescaler>>LTC_SPICLK_BR_POSITION)+1 );
+}
+
+
+#if LTC_ADAPTIVE_SPI_CLOCK == TRUE
+void LTC_SPICLK_Init(void) {
+
+    uint32_t pclk = LTC_SPICLK_GetPCLK(LTC_SPI_HANDLE);
+    LTC_SPICLK_STATE_s *state = &ltc_spiclk_state;
+
+    state->fastest = 0;
+    while((state->fastest < LTC_SPICLK_N_PRESCALERS-1) && ((pclk>>(state->fastest+1)) > LTC_SPICLK_MAX_FREQ)) {
+        state->fastest++;
+    }
+    state->slowest = LTC_SPICLK_N_PRESCALERS-1;
+    while((state->slowest > state->fastest) && ((pclk>>(state->slowest+1)) < LTC_SPICLK_MIN_FREQ)) {
+        state->slowest--;
+    }
+
+    state->prescaler = (LTC_SPI_HANDLE)->Init.BaudRatePrescaler>>LTC_SPICLK_BR_POSITION;
+    if(state->prescaler < state->fastest) {
+        state->prescaler = state->fastest;
+        ltc_spiclk_pending = TRUE;
+    }
+    if(state->prescaler > state->slowest) {
+        state->prescaler = state->slowest;
+        ltc_spiclk_pending = TRUE;
+    }
+
+    state->probing = FALSE;
+    state->frames = 0;
+    state->errorFrames = 0;
+    state->cleanWindows = 0;
+    if(ltc_spiclk_initialized == FALSE) {
+        // the backoff is kept on a re-initialization after repeated PEC errors
+        state->cleanWindowsNeeded = LTC_SPICLK_CLEAN_WINDOWS;
+    }
+    ltc_spiclk_initialized = TRUE;
+}
+
+
+void LTC_SPICLK_CountFrame(uint8_t pecFailed) {
+
+    LTC_SPICLK_STATE_s *state = &ltc_spiclk_state;
+
+    state->frames++;
+    if(pecFailed == TRUE) {
+        state->errorFrames++;
+    }
+    if(state->frames >= LTC_SPICLK_WINDOW) {
+        LTC_SPICLK_EndWindow(state, (state->errorFrames >= LTC_SPICLK_ERRORS_SLOWER) ? TRUE : FALSE);
+    }
+}
+
+
+void LTC_SPICLK_PECErrorLimit(void) {
+
+    if(ltc_spiclk_state.errorFrames > 0) {
+        LTC_SPICLK_EndWindow(&ltc_spiclk_state, TRUE);
+    }
+}
+
+
+uint8_t LTC_SPICLK_Apply(void) {
+
+    uint8_t changed = FALSE;
+    uint32_t prescaler = 0;
+
+    if(ltc_spiclk_pending == FALSE) {
+        return FALSE;
+    }
+
+    ltc_spiclk_pending = FALSE;
+    prescaler = (uint32_t)ltc_spiclk_state.prescaler<<LTC_SPICLK_BR_POSITION;
+    if((LTC_SPI_HANDLE)->Init.BaudRatePrescaler != prescaler) {
+        if(SPI_SetPrescaler(LTC_SPI_HANDLE, prescaler) == E_OK) {
+            // the frames received with the previous clock are not evaluated
+            ltc_spiclk_state.frames = 0;
+            ltc_spiclk_state.errorFrames = 0;
+            changed = TRUE;
+        } else {
+            ltc_spiclk_pending = TRUE;    // frames queued, retry at the next call
+        }
+    }
+    return changed;
+}
+
+
+/**
+ * @brief   evaluates the window of frames and changes the prescaler if needed.
+ *
+ * @param   *state      adaptation state of the SPI clock
+ * @param   slower      TRUE if the clock has to be slowed down
+ *
+ * @return  void
+ */
+static void LTC_SPICLK_EndWindow(LTC_SPICLK_STATE_s *state, uint8_t slower) {
+
+    if(slower == TRUE) {
+        if((state->probing == TRUE) && (state->cleanWindowsNeeded < LTC_SPICLK_CLEAN_WINDOWS*LTC_SPICLK_MAX_BACKOFF)) {
+            state->cleanWindowsNeeded *= 2;     // the faster clock failed at once, retry later
+        }
+        if(state->prescaler < state->slowest) {
+            state->prescaler++;
+            ltc_spiclk_pending = TRUE;
+        }
+        state->cleanWindows = 0;
+        state->probing = FALSE;
+    } else if(state->errorFrames == 0) {
+        state->cleanWindows++;
+        state->probing = FALSE;
+        if((state->cleanWindows >= state->cleanWindowsNeeded) && (state->prescaler > state->fastest)) {
+            state->prescaler--;
+            ltc_spiclk_pending = TRUE;
+            state->cleanWindows = 0;
+            state->probing = TRUE;
+        }
+    } else {
+        // single error: neither slow down nor count the window as clean
+        state->cleanWindows = 0;
+        state->probing = FALSE;
+    }
+
+    state->frames = 0;
+    state->errorFrames = 0;
+}
+#endif
+
+
+/**
+ * @brief   gets the peripheral clock of an SPI device.
+ *
+ * @param   *hspi   pointer to SPI hardware handle
+ *
+ * @return  peripheral clock in Hz, 0 for an unknown SPI instance
+ */
+static uint32_t LTC_SPICLK_GetPCLK(SPI_HandleTypeDef *hspi) {
+
+    uint32_t pclk = 0;
+
+    if (hspi->Instance == SPI2 || hspi->Instance == SPI3) {
+        // SPI2 and SPI3 are connected to APB1 (PCLK1)
+        pclk = HAL_RCC_GetPCLK1Freq();
+    }
+
+    if (hspi->Instance == SPI1 || hspi->Instance == SPI4 || hspi->Instance == SPI5 || hspi->Instance == SPI6) {
+        // SPI1, SPI4, SPI5 and SPI6 are connected to APB2 (PCLK2)
+        pclk = HAL_RCC_GetPCLK2Freq();
+    }
+
+    return pclk;
+}
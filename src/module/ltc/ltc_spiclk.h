@@ -0,0 +1,99 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_spiclk.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_SPICLK
+ *
+ * @brief   Headers for the adaptation of the SPI clock of the LTC daisy-chain.
+ *
+ */
+
+#ifndef LTC_SPICLK_H_
+#define LTC_SPICLK_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   gets the SPI clock of an SPI device.
+ *
+ * @param   *hspi   pointer to SPI hardware handle
+ *
+ * @return  SPI clock in Hz, 0 for an unknown SPI instance
+ */
+extern uint32_t LTC_SPICLK_GetFrequency(SPI_HandleTypeDef *hspi);
+
+/**
+ * @brief   initializes the adaptation of the SPI clocks.
+ *
+ * Computes the prescaler bounds of the daisy-chain from LTC_SPICLK_MIN_FREQ and
+ * LTC_SPICLK_MAX_FREQ. The current prescaler and the backoff are kept on a re-initialization.
+ *
+ * @return  void
+ */
+extern void LTC_SPICLK_Init(void);
+
+/**
+ * @brief   counts a frame received from the daisy-chain whose PECs were checked.
+ *
+ * At the end of each window of LTC_SPICLK_WINDOW frames, the prescaler
+ * is changed if needed. The change is applied by LTC_SPICLK_Apply().
+ *
+ * @param   pecFailed   TRUE if at least one LTC of the frame had a wrong PEC
+ *
+ * @return  void
+ */
+extern void LTC_SPICLK_CountFrame(uint8_t pecFailed);
+
+/**
+ * @brief   slows down the SPI clock if there were PEC errors in the current window.
+ *
+ * Called when the driver stops because of repeated PEC errors, before a window
+ * of LTC_SPICLK_WINDOW frames could be completed.
+ *
+ * @return  void
+ */
+extern void LTC_SPICLK_PECErrorLimit(void);
+
+/**
+ * @brief   applies the pending prescaler changes.
+ *
+ * The prescaler is only changed while no frame is queued,
+ * otherwise the change stays pending until the next call.
+ *
+ * @return  TRUE if the SPI clock was changed, FALSE otherwise
+ */
+extern uint8_t LTC_SPICLK_Apply(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_SPICLK_H_ */
@@ -0,0 +1,247 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_sync.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_SYNC
+ *
+ * @brief   Synchronization of the cell voltages with the current.
+ *
+ * The ADCs of an LTC convert their cells one after another: the first step converts the cells
+ * 1 and 7 (and 13 on the LTC6813), the last step the cells 6 and 12 (and 18). The register
+ * groups A, C, E are thus converted in the first half of the conversion, B, D, F in the second.
+ * The conversion time of each step is taken as the center of the step.
+ *
+ * The current samples (DATA_BLOCK_ID_CURRENT) are received asynchronously. They are polled
+ * while a conversion is pending, the current at each step is interpolated linearly between the
+ * last sample before and the first sample after the step. The cell voltages with the
+ * interpolated current are stored in DATA_BLOCK_ID_CELLVOLTAGE_CURRENT, no additional
+ * conversion is needed.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_sync.h"
+
+#include "mcu.h"
+
+/*================== Macros and Definitions ===============================*/
+
+#if (LTC_VOLTAGE_CURRENT_SYNC == TRUE) && (DATA_SEQLOCK_ACCESS != TRUE)
+#error "LTC_VOLTAGE_CURRENT_SYNC needs DATA_SEQLOCK_ACCESS"
+#endif
+
+/**
+ * number of cells converted one after another by each ADC of an LTC
+ */
+#define LTC_SYNC_N_STEPS        6
+
+/**
+ * state of the current of a conversion step
+ */
+typedef enum {
+    LTC_SYNC_WAITING        = 0,    /*!< no current sample after the step received yet      */
+    LTC_SYNC_INTERPOLATED   = 1,    /*!< current interpolated                               */
+    LTC_SYNC_INVALID        = 2,    /*!< no current sample before the step or samples too far apart */
+} LTC_SYNC_STEPSTATE_e;
+
+/*================== Constant and Variable Definitions ====================*/
+
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+static uint8_t ltc_sync_pending = FALSE;                    // conversion started, pairs not yet stored
+static uint8_t ltc_sync_voltagesRead = FALSE;
+static uint32_t ltc_sync_step_us[LTC_SYNC_N_STEPS];         // conversion time of each step
+static float ltc_sync_step_current[LTC_SYNC_N_STEPS];
+static LTC_SYNC_STEPSTATE_e ltc_sync_step_state[LTC_SYNC_N_STEPS];
+static uint8_t ltc_sync_current_received = FALSE;           // TRUE if ltc_sync_current is a received sample
+static float ltc_sync_current = 0.0;                        // last current sample
+static uint32_t ltc_sync_current_us = 0;                    // reception of the last current sample
+static DATA_BLOCK_CELLVOLTAGE_CURRENT_s ltc_sync_pairs;
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+static void LTC_SYNC_UpdateCurrent(void);
+static void LTC_SYNC_Store(void);
+#endif
+
+/*================== Function Implementations =============================*/
+
+#if LTC_VOLTAGE_CURRENT_SYNC == TRUE
+
+void LTC_SYNC_ConversionStarted(uint32_t start_us, LTC_ADCMODE_e adcMode) {
+
+    uint8_t step = 0;
+    uint32_t tcycle_us = 0;
+
+    if((adcMode == LTC_ADCMODE_FAST_DCP0) || (adcMode == LTC_ADCMODE_FAST_DCP1)) {
+        tcycle_us = LTC_MEAS_ALL_FAST_TCYCLE_US;
+    }
+    else if((adcMode == LTC_ADCMODE_FILTERED_DCP0) || (adcMode == LTC_ADCMODE_FILTERED_DCP1)) {
+        tcycle_us = LTC_MEAS_ALL_FILTERED_TCYCLE_US;
+    }
+    else {
+        tcycle_us = LTC_MEAS_ALL_NORMAL_TCYCLE_US;
+    }
+
+    // last sample before the conversion, the steps of a discarded conversion are not used anymore
+    LTC_SYNC_UpdateCurrent();
+
+    for(step=0;step<LTC_SYNC_N_STEPS;step++) {
+        ltc_sync_step_us[step] = start_us + (tcycle_us*(2*step+1))/(2*LTC_SYNC_N_STEPS);
+        ltc_sync_step_state[step] = LTC_SYNC_WAITING;
+    }
+
+    ltc_sync_pending = TRUE;
+    ltc_sync_voltagesRead = FALSE;
+}
+
+
+void LTC_SYNC_VoltagesRead(DATA_BLOCK_CELLVOLTAGE_s *cellvoltage) {
+
+    uint16_t i = 0;
+
+    if((ltc_sync_pending == FALSE) || (ltc_sync_voltagesRead == TRUE)) {
+        return;
+    }
+
+    for(i=0;i<BS_NR_OF_BAT_CELLS;i++) {
+        ltc_sync_pairs.voltage[i] = cellvoltage->voltage[i];
+    }
+    for(i=0;i<BS_NR_OF_MODULES;i++) {
+        ltc_sync_pairs.valid[i] = cellvoltage->valid_voltPECs[i];
+    }
+    ltc_sync_voltagesRead = TRUE;
+
+    LTC_SYNC_Trigger();
+}
+
+
+void LTC_SYNC_Trigger(void) {
+
+    uint8_t step = 0;
+
+    if(ltc_sync_pending == FALSE) {
+        return;
+    }
+
+    LTC_SYNC_UpdateCurrent();
+
+    if(ltc_sync_voltagesRead == FALSE) {
+        return;
+    }
+    for(step=0;step<LTC_SYNC_N_STEPS;step++) {
+        if(ltc_sync_step_state[step] == LTC_SYNC_WAITING) {
+            return;
+        }
+    }
+
+    LTC_SYNC_Store();
+    ltc_sync_pending = FALSE;
+}
+
+
+/**
+ * @brief   reads the current and interpolates it to the steps received since the last sample.
+ *
+ * @return  void
+ */
+static void LTC_SYNC_UpdateCurrent(void) {
+
+    DATA_BLOCK_CURRENT_s current;
+    uint8_t step = 0;
+    uint32_t interval_us = 0;
+
+    if(DATA_GetTable(&current, DATA_BLOCK_ID_CURRENT) != E_OK) {
+        return;
+    }
+    if((current.timestamp == 0) || ((ltc_sync_current_received == TRUE) && (current.timestamp_us == ltc_sync_current_us))) {
+        return;     // no new sample
+    }
+
+    interval_us = current.timestamp_us - ltc_sync_current_us;
+
+    for(step=0;step<LTC_SYNC_N_STEPS;step++) {
+        if((ltc_sync_step_state[step] != LTC_SYNC_WAITING) || ((int32_t)(current.timestamp_us - ltc_sync_step_us[step]) < 0)) {
+            continue;   // done or sample before the step
+        }
+        if((ltc_sync_current_received == TRUE) && ((int32_t)(ltc_sync_step_us[step] - ltc_sync_current_us) >= 0) &&
+                (interval_us > 0) && (interval_us <= (LTC_SYNC_MAX_CURRENT_INTERVAL*1000))) {
+            ltc_sync_step_current[step] = ltc_sync_current + ((current.current - ltc_sync_current) *
+                    (float)(ltc_sync_step_us[step] - ltc_sync_current_us)) / (float)interval_us;
+            ltc_sync_step_state[step] = LTC_SYNC_INTERPOLATED;
+        }
+        else {
+            ltc_sync_step_current[step] = current.current;
+            ltc_sync_step_state[step] = LTC_SYNC_INVALID;
+        }
+    }
+
+    ltc_sync_current = current.current;
+    ltc_sync_current_us = current.timestamp_us;
+    ltc_sync_current_received = TRUE;
+}
+
+
+/**
+ * @brief   stores the cell voltages with the current of their conversion step in the database.
+ *
+ * @return  void
+ */
+static void LTC_SYNC_Store(void) {
+
+    uint16_t module = 0;
+    uint16_t cell = 0;
+    uint16_t index = 0;
+    uint8_t step = 0;
+
+    for(module=0;module<BS_NR_OF_MODULES;module++) {
+        for(cell=0;cell<BS_NR_OF_BAT_CELLS_PER_MODULE;cell++) {
+            // cell of the LTC, the ADCs convert the cells 0..5, 6..11 and 12..17 in parallel
+            step = (cell%LTC_N_CELLS_PER_LTC)%LTC_SYNC_N_STEPS;
+            index = module*BS_NR_OF_BAT_CELLS_PER_MODULE + cell;
+            ltc_sync_pairs.current[index] = ltc_sync_step_current[step];
+            ltc_sync_pairs.conversion_us[index] = ltc_sync_step_us[step];
+            if(ltc_sync_step_state[step] != LTC_SYNC_INTERPOLATED) {
+                ltc_sync_pairs.valid[module] |= ((uint32_t)1 << cell);
+            }
+        }
+    }
+
+    ltc_sync_pairs.previous_timestamp = ltc_sync_pairs.timestamp;
+    ltc_sync_pairs.timestamp = MCU_GetTimeStamp();
+    DATA_StoreDataBlock(&ltc_sync_pairs, DATA_BLOCK_ID_CELLVOLTAGE_CURRENT);
+}
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_sync.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_SYNC
+ *
+ * @brief   Headers for the synchronization of the cell voltages with the current.
+ *
+ */
+
+#ifndef LTC_SYNC_H_
+#define LTC_SYNC_H_
+
+/*================== Includes =============================================*/
+#include "ltc.h"
+#include "database.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   notifies the start of a cell voltage conversion.
+ *
+ * Computes the conversion time of each cell. A previous conversion whose current could not be
+ * interpolated yet is discarded.
+ *
+ * @param   start_us    start of the conversion, i.e. end of the ADCV command, unit: us (MCU_GetTime_us())
+ * @param   adcMode     ADC mode of the conversion
+ *
+ * @return  void
+ */
+extern void LTC_SYNC_ConversionStarted(uint32_t start_us, LTC_ADCMODE_e adcMode);
+
+/**
+ * @brief   notifies that the cell voltages of the last conversion were read.
+ *
+ * @param   *cellvoltage    cell voltages and PEC status of the last conversion
+ *
+ * @return  void
+ */
+extern void LTC_SYNC_VoltagesRead(DATA_BLOCK_CELLVOLTAGE_s *cellvoltage);
+
+/**
+ * @brief   interpolates the current to the conversion times.
+ *
+ * Must be called periodically (1ms) by the LTC driver. Once a current sample after the
+ * conversion of the last cell was received and the voltages were read, the pairs are stored
+ * in DATA_BLOCK_ID_CELLVOLTAGE_CURRENT.
+ *
+ * @return  void
+ */
+extern void LTC_SYNC_Trigger(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_SYNC_H_ */
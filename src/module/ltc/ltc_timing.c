@@ -0,0 +1,444 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_timing.c
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_TIMING
+ *
+ * @brief   Timing instrumentation of the LTC state machine.
+ *
+ * LTC_Trigger() is called every 1ms. A step of the state machine first waits until ltc_state.timer
+ * has elapsed, then until the SPI transfers queued by the previous step are finished, then the
+ * state machine is executed. These three parts are timed with MCU_GetTime_us():
+ *
+ * - each visit of a substate is stored with its entry and exit time and the three parts in a ring
+ *   buffer of LTC_TIMING_TRACE_LENGTH entries, read with LTC_TIMING_GetTraceEntry()
+ * - the time from entry to exit of each state and the duration of the measurement cycles are
+ *   evaluated (minimum, mean, maximum and histogram). For the last and the longest cycle, the
+ *   three parts are summed up, so that a slow cycle can be assigned to the conversions and the
+ *   timer resolution, the SPI transfers or the CPU time of the driver
+ *
+ * The statistics are stored in DATA_BLOCK_ID_LTC_TIMING every LTC_TIMING_PERIOD_MS. Every
+ * LTC_TIMING_PRINT_PERIOD_MS, the statistics and the last LTC_TIMING_PRINT_TRACE_ENTRIES visits of
+ * the trace buffer are printed on the debug UART with LTC_TIMING_Print(), one line every
+ * LTC_TIMING_PRINT_LINE_MS.
+ *
+ */
+
+/*================== Includes =============================================*/
+/* recommended include order of header files:
+ * 
+ * 1.    include general.h
+ * 2.    include module's own header
+ * 3...  other headers
+ *
+ */
+#include "general.h"
+#include "ltc_timing.h"
+
+#include "database.h"
+#include "mcu.h"
+#include "misc.h"
+#include "uart.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * index of a state in DATA_BLOCK_LTC_TIMING_s.state_duration, the error states are counted in the last
+ * entry (LTC_STATEMACH_UNDEFINED)
+ */
+#define LTC_TIMING_STATE_INDEX(state)   (((state) < DATA_LTC_TIMING_NR_OF_STATES-1) ? (state) : DATA_LTC_TIMING_NR_OF_STATES-1)
+
+/**
+ * lines of the output of LTC_TIMING_Print(), one line per visited state and per trace entry
+ */
+#define LTC_TIMING_PRINT_LINE_NONE      0
+#define LTC_TIMING_PRINT_LINE_CYCLE     1
+#define LTC_TIMING_PRINT_LINE_LAST      2
+#define LTC_TIMING_PRINT_LINE_LONGEST   3
+#define LTC_TIMING_PRINT_LINE_STATE     4
+#define LTC_TIMING_PRINT_LINE_TRACE     (LTC_TIMING_PRINT_LINE_STATE + DATA_LTC_TIMING_NR_OF_STATES)
+
+/**
+ * running visit of a substate
+ */
+typedef struct {
+    uint8_t state;              /*!< state of the visit                                         */
+    uint8_t substate;           /*!< substate of the visit                                      */
+    uint8_t timerElapsed;       /*!< TRUE if the timer of the current step has elapsed          */
+    uint32_t entry_us;          /*!< entry into the substate                                    */
+    uint32_t mark_us;           /*!< end of the last timed part                                 */
+    uint32_t timer_us;          /*!< wait for ltc_state.timer in this visit                     */
+    uint32_t transfer_us;       /*!< wait for SPI transfers in this visit                       */
+    uint32_t handler_us;        /*!< time spent in LTC_Trigger() in this visit                  */
+} LTC_TIMING_VISIT_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+static LTC_TIMING_TRACE_ENTRY_s ltc_timing_trace[LTC_TIMING_TRACE_LENGTH];
+static uint16_t ltc_timing_traceNext = 0;       // entry written next
+static uint16_t ltc_timing_traceCount = 0;      // valid entries in the ring buffer
+static LTC_TIMING_VISIT_s ltc_timing_visit;
+static uint8_t ltc_timing_started = FALSE;      // FALSE until the first step was executed
+static uint32_t ltc_timing_stateEntry_us = 0;
+
+static uint8_t ltc_timing_cycleStarted = FALSE; // FALSE until the end of the first cycle (contains the initialization)
+static uint32_t ltc_timing_cycleStart_us = 0;
+static uint32_t ltc_timing_cycleTimer_us = 0;
+static uint32_t ltc_timing_cycleTransfer_us = 0;
+static uint32_t ltc_timing_cycleHandler_us = 0;
+
+static DATA_BLOCK_LTC_TIMING_s ltc_timing;
+static uint64_t ltc_timing_cycleSum_us = 0;
+static uint64_t ltc_timing_stateSum_us[DATA_LTC_TIMING_NR_OF_STATES];
+static uint32_t ltc_timing_lastUpdate = 0;
+static uint32_t ltc_timing_lastPrint = 0;
+static uint32_t ltc_timing_lastPrintLine = 0;
+static uint16_t ltc_timing_printLine = LTC_TIMING_PRINT_LINE_NONE;    // next line printed by LTC_TIMING_PrintLine()
+static LTC_TIMING_TRACE_ENTRY_s ltc_timing_printTrace[LTC_TIMING_PRINT_TRACE_ENTRIES];
+static uint16_t ltc_timing_printTraceCount = 0;
+#endif
+
+/*================== Function Prototypes ==================================*/
+
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+static void LTC_TIMING_AddDuration(DATA_LTC_TIMING_STATISTICS_s *statistics, uint64_t *sum_us, uint32_t duration_us, uint32_t binWidth_us);
+static uint16_t LTC_TIMING_Saturate(uint32_t duration_us);
+static void LTC_TIMING_PrintLine(void);
+#endif
+
+/*================== Function Implementations =============================*/
+
+#if LTC_TIMING_INSTRUMENTATION == TRUE
+void LTC_TIMING_TimerElapsed(void) {
+
+    uint32_t now = 0;
+
+    if((ltc_timing_started == FALSE) || (ltc_timing_visit.timerElapsed == TRUE)) {
+        return;     // the following calls of this step wait for the SPI transfers
+    }
+    now = MCU_GetTime_us();
+    ltc_timing_visit.timer_us += now - ltc_timing_visit.mark_us;
+    ltc_timing_cycleTimer_us += now - ltc_timing_visit.mark_us;
+    ltc_timing_visit.mark_us = now;
+    ltc_timing_visit.timerElapsed = TRUE;
+}
+
+
+void LTC_TIMING_StepStart(void) {
+
+    uint32_t now = 0;
+
+    if(ltc_timing_started == FALSE) {
+        return;
+    }
+    now = MCU_GetTime_us();
+    ltc_timing_visit.transfer_us += now - ltc_timing_visit.mark_us;
+    ltc_timing_cycleTransfer_us += now - ltc_timing_visit.mark_us;
+    ltc_timing_visit.mark_us = now;
+}
+
+
+void LTC_TIMING_StepEnd(uint8_t state, uint8_t substate) {
+
+    uint32_t now = MCU_GetTime_us();
+    uint8_t index = 0;
+    LTC_TIMING_TRACE_ENTRY_s *entry = NULL_PTR;
+
+    if(ltc_timing_started == FALSE) {
+        ltc_timing_started = TRUE;
+        ltc_timing_stateEntry_us = now;
+    }
+    else {
+        ltc_timing_visit.handler_us += now - ltc_timing_visit.mark_us;
+        ltc_timing_cycleHandler_us += now - ltc_timing_visit.mark_us;
+        ltc_timing_visit.mark_us = now;
+        ltc_timing_visit.timerElapsed = FALSE;
+
+        if((state == ltc_timing_visit.state) && (substate == ltc_timing_visit.substate)) {
+            return;     // the visit continues with the next step
+        }
+
+        entry = &ltc_timing_trace[ltc_timing_traceNext];
+        entry->entry_us = ltc_timing_visit.entry_us;
+        entry->exit_us = now;
+        entry->timer_us = LTC_TIMING_Saturate(ltc_timing_visit.timer_us);
+        entry->transfer_us = LTC_TIMING_Saturate(ltc_timing_visit.transfer_us);
+        entry->handler_us = LTC_TIMING_Saturate(ltc_timing_visit.handler_us);
+        entry->state = ltc_timing_visit.state;
+        entry->substate = ltc_timing_visit.substate;
+        if(++ltc_timing_traceNext >= LTC_TIMING_TRACE_LENGTH) {
+            ltc_timing_traceNext = 0;
+        }
+        if(ltc_timing_traceCount < LTC_TIMING_TRACE_LENGTH) {
+            ltc_timing_traceCount++;
+        }
+
+        if(state != ltc_timing_visit.state) {
+            index = LTC_TIMING_STATE_INDEX(ltc_timing_visit.state);
+            LTC_TIMING_AddDuration(&ltc_timing.state_duration[index], &ltc_timing_stateSum_us[index], now - ltc_timing_stateEntry_us, LTC_TIMING_STATE_BIN_US);
+            ltc_timing_stateEntry_us = now;
+        }
+    }
+
+    // start a new visit
+    ltc_timing_visit.state = state;
+    ltc_timing_visit.substate = substate;
+    ltc_timing_visit.timerElapsed = FALSE;
+    ltc_timing_visit.entry_us = now;
+    ltc_timing_visit.mark_us = now;
+    ltc_timing_visit.timer_us = 0;
+    ltc_timing_visit.transfer_us = 0;
+    ltc_timing_visit.handler_us = 0;
+}
+
+
+void LTC_TIMING_CycleFinished(void) {
+
+    uint32_t now = MCU_GetTime_us();
+    uint32_t duration = now - ltc_timing_cycleStart_us;
+
+    if(ltc_timing_cycleStarted == TRUE) {
+        LTC_TIMING_AddDuration(&ltc_timing.cycle, &ltc_timing_cycleSum_us, duration, LTC_TIMING_CYCLE_BIN_US);
+        ltc_timing.last_cycle_timer_us = ltc_timing_cycleTimer_us;
+        ltc_timing.last_cycle_transfer_us = ltc_timing_cycleTransfer_us;
+        ltc_timing.last_cycle_handler_us = ltc_timing_cycleHandler_us;
+        if(duration >= ltc_timing.cycle.max_us) {
+            ltc_timing.max_cycle_timer_us = ltc_timing_cycleTimer_us;
+            ltc_timing.max_cycle_transfer_us = ltc_timing_cycleTransfer_us;
+            ltc_timing.max_cycle_handler_us = ltc_timing_cycleHandler_us;
+        }
+    }
+    ltc_timing_cycleStarted = TRUE;
+    ltc_timing_cycleStart_us = now;
+    ltc_timing_cycleTimer_us = 0;
+    ltc_timing_cycleTransfer_us = 0;
+    ltc_timing_cycleHandler_us = 0;
+}
+
+
+STD_RETURN_TYPE_e LTC_TIMING_GetTraceEntry(uint16_t index, LTC_TIMING_TRACE_ENTRY_s *entry) {
+
+    uint16_t position = 0;
+
+    if((entry == NULL_PTR) || (index >= ltc_timing_traceCount)) {
+        return E_NOT_OK;
+    }
+    position = (ltc_timing_traceNext + LTC_TIMING_TRACE_LENGTH - ltc_timing_traceCount + index) % LTC_TIMING_TRACE_LENGTH;
+    *entry = ltc_timing_trace[position];
+    return E_OK;
+}
+
+
+void LTC_TIMING_Trigger(void) {
+
+    uint16_t i = 0;
+    uint32_t now = MCU_GetTimeStamp();
+
+#if LTC_TIMING_PRINT_PERIOD_MS > 0
+    if((now - ltc_timing_lastPrint) >= LTC_TIMING_PRINT_PERIOD_MS) {
+        ltc_timing_lastPrint = now;
+        ltc_timing_lastPrintLine = now;
+        LTC_TIMING_Print();
+    }
+#endif
+    if((ltc_timing_printLine != LTC_TIMING_PRINT_LINE_NONE) && ((now - ltc_timing_lastPrintLine) >= LTC_TIMING_PRINT_LINE_MS)) {
+        ltc_timing_lastPrintLine = now;
+        LTC_TIMING_PrintLine();
+    }
+
+    if((now - ltc_timing_lastUpdate) < LTC_TIMING_PERIOD_MS) {
+        return;
+    }
+    ltc_timing_lastUpdate = now;
+
+    if(ltc_timing.cycle.count > 0) {
+        ltc_timing.cycle.avg_us = (uint32_t)(ltc_timing_cycleSum_us/ltc_timing.cycle.count);
+    }
+    for(i=0;i<DATA_LTC_TIMING_NR_OF_STATES;i++) {
+        if(ltc_timing.state_duration[i].count > 0) {
+            ltc_timing.state_duration[i].avg_us = (uint32_t)(ltc_timing_stateSum_us[i]/ltc_timing.state_duration[i].count);
+        }
+    }
+
+    ltc_timing.previous_timestamp = ltc_timing.timestamp;
+    ltc_timing.timestamp = now;
+    DATA_StoreDataBlock(&ltc_timing, DATA_BLOCK_ID_LTC_TIMING);
+}
+
+
+void LTC_TIMING_Print(void) {
+
+    uint16_t index = 0;
+
+    // snapshot of the trace, the ring buffer moves on while the lines are printed
+    ltc_timing_printTraceCount = 0;
+    if(ltc_timing_traceCount > LTC_TIMING_PRINT_TRACE_ENTRIES) {
+        index = ltc_timing_traceCount - LTC_TIMING_PRINT_TRACE_ENTRIES;
+    }
+    for(;LTC_TIMING_GetTraceEntry(index, &ltc_timing_printTrace[ltc_timing_printTraceCount]) == E_OK;index++) {
+        ltc_timing_printTraceCount++;
+    }
+    ltc_timing_printLine = LTC_TIMING_PRINT_LINE_CYCLE;
+}
+
+/*================== Static functions =====================================*/
+
+/**
+ * @brief   adds a duration to the statistics.
+ *
+ * @param   *statistics     statistics of the duration
+ * @param   *sum_us         sum of the durations, used for the mean
+ * @param   duration_us     measured duration in us
+ * @param   binWidth_us     width of a bin of the histogram in us
+ *
+ * @return  void
+ */
+static void LTC_TIMING_AddDuration(DATA_LTC_TIMING_STATISTICS_s *statistics, uint64_t *sum_us, uint32_t duration_us, uint32_t binWidth_us) {
+
+    uint32_t bin = duration_us/binWidth_us;
+
+    if(bin >= DATA_LTC_TIMING_NR_OF_BINS) {
+        bin = DATA_LTC_TIMING_NR_OF_BINS-1;
+    }
+    if((statistics->count == 0) || (duration_us < statistics->min_us)) {
+        statistics->min_us = duration_us;
+    }
+    if(duration_us > statistics->max_us) {
+        statistics->max_us = duration_us;
+    }
+    if(statistics->count < 0xFFFFFFFF) {
+        statistics->count++;
+        *sum_us += duration_us;
+    }
+    if(statistics->histogram[bin] < 0xFFFF) {
+        statistics->histogram[bin]++;
+    }
+}
+
+
+/**
+ * @brief   limits a duration to the 16 bit fields of the trace buffer.
+ *
+ * @param   duration_us     duration in us
+ *
+ * @return  duration in us, 0xFFFF if longer
+ */
+static uint16_t LTC_TIMING_Saturate(uint32_t duration_us) {
+
+    return (duration_us > 0xFFFF) ? 0xFFFF : (uint16_t)duration_us;
+}
+
+
+/**
+ * @brief   prints the next line of the output started by LTC_TIMING_Print().
+ *
+ * One line per call, so that the transmit buffer of the UART (TXBUF_LENGTH) does not overflow.
+ *
+ * @return  void
+ */
+static void LTC_TIMING_PrintLine(void) {
+
+    uint8_t buf[12] = {0,0,0,0,0,0,0,0,0,0,0,0};   // I32ToDecascii() does not terminate the string, UART_vWrite() clears it
+    uint32_t i = 0;
+    uint32_t value = 0;
+    LTC_TIMING_TRACE_ENTRY_s *entry = NULL_PTR;
+
+    if(ltc_timing_printLine == LTC_TIMING_PRINT_LINE_CYCLE) {
+        DEBUG_PRINTF((const uint8_t * )"LTC cycles: count / min us / avg us / max us: ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.cycle.count));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.cycle.min_us));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.cycle.avg_us));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.cycle.max_us));
+        DEBUG_PRINTF((const uint8_t * )"\r\n");
+        ltc_timing_printLine++;
+    } else if(ltc_timing_printLine == LTC_TIMING_PRINT_LINE_LAST) {
+        DEBUG_PRINTF((const uint8_t * )"LTC last cycle: timer / transfer / handler us: ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.last_cycle_timer_us));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.last_cycle_transfer_us));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.last_cycle_handler_us));
+        DEBUG_PRINTF((const uint8_t * )"\r\n");
+        ltc_timing_printLine++;
+    } else if(ltc_timing_printLine == LTC_TIMING_PRINT_LINE_LONGEST) {
+        DEBUG_PRINTF((const uint8_t * )"LTC longest cycle: timer / transfer / handler us: ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.max_cycle_timer_us));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.max_cycle_transfer_us));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.max_cycle_handler_us));
+        DEBUG_PRINTF((const uint8_t * )"\r\n");
+        ltc_timing_printLine++;
+    } else if(ltc_timing_printLine < LTC_TIMING_PRINT_LINE_TRACE) {
+        // next visited state
+        i = ltc_timing_printLine - LTC_TIMING_PRINT_LINE_STATE;
+        while((i < DATA_LTC_TIMING_NR_OF_STATES) && (ltc_timing.state_duration[i].count == 0)) {
+            i++;
+        }
+        if(i < DATA_LTC_TIMING_NR_OF_STATES) {
+            DEBUG_PRINTF((const uint8_t * )"LTC state ");
+            DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&i));
+            DEBUG_PRINTF((const uint8_t * )": count / avg us / max us: ");
+            DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.state_duration[i].count));
+            DEBUG_PRINTF((const uint8_t * )" / ");
+            DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.state_duration[i].avg_us));
+            DEBUG_PRINTF((const uint8_t * )" / ");
+            DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&ltc_timing.state_duration[i].max_us));
+            DEBUG_PRINTF((const uint8_t * )"\r\n");
+            ltc_timing_printLine = LTC_TIMING_PRINT_LINE_STATE + i + 1;
+        } else {
+            ltc_timing_printLine = LTC_TIMING_PRINT_LINE_TRACE;
+        }
+    } else if(ltc_timing_printLine < (LTC_TIMING_PRINT_LINE_TRACE + ltc_timing_printTraceCount)) {
+        entry = &ltc_timing_printTrace[ltc_timing_printLine - LTC_TIMING_PRINT_LINE_TRACE];
+        DEBUG_PRINTF((const uint8_t * )"LTC trace ");
+        value = entry->state;
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&value));
+        DEBUG_PRINTF((const uint8_t * )".");
+        value = entry->substate;
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&value));
+        DEBUG_PRINTF((const uint8_t * )" at ");
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&entry->entry_us));
+        DEBUG_PRINTF((const uint8_t * )" us: timer / transfer / handler us: ");
+        value = entry->timer_us;
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&value));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        value = entry->transfer_us;
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&value));
+        DEBUG_PRINTF((const uint8_t * )" / ");
+        value = entry->handler_us;
+        DEBUG_PRINTF(I32ToDecascii(buf, (int32_t*)&value));
+        DEBUG_PRINTF((const uint8_t * )"\r\n");
+        ltc_timing_printLine++;
+    } else {
+        ltc_timing_printLine = LTC_TIMING_PRINT_LINE_NONE;   // output finished
+    }
+}
+#endif
@@ -0,0 +1,136 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2017, Fraunhofer-Gesellschaft zur Foerderung der angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    ltc_timing.h
+ * @author  foxBMS Team
+ * @date    17.10.2026 (date of creation)
+ * @ingroup DRIVERS
+ * @prefix  LTC_TIMING
+ *
+ * @brief   Headers for the timing instrumentation of the LTC state machine.
+ *
+ */
+
+#ifndef LTC_TIMING_H_
+#define LTC_TIMING_H_
+
+/*================== Includes =============================================*/
+#include "ltc_cfg.h"
+
+/*================== Macros and Definitions ===============================*/
+
+/**
+ * one visit of a substate in the trace buffer
+ *
+ * exit_us-entry_us is the sum of timer_us, transfer_us and handler_us (each saturates at 0xFFFF).
+ */
+typedef struct {
+    uint32_t entry_us;          /*!< entry into the substate, unit: us (MCU_GetTime_us())                       */
+    uint32_t exit_us;           /*!< exit of the substate, unit: us (MCU_GetTime_us())                          */
+    uint16_t timer_us;          /*!< wait for ltc_state.timer, unit: us                                         */
+    uint16_t transfer_us;       /*!< wait for the SPI transfers queued by the previous substate, unit: us       */
+    uint16_t handler_us;        /*!< time spent in LTC_Trigger() after the waits, unit: us                      */
+    uint8_t state;              /*!< state (LTC_STATEMACH_e)                                                    */
+    uint8_t substate;           /*!< substate                                                                   */
+} LTC_TIMING_TRACE_ENTRY_s;
+
+/*================== Constant and Variable Definitions ====================*/
+
+/*================== Function Prototypes ==================================*/
+
+/**
+ * @brief   marks the end of the wait for ltc_state.timer.
+ *
+ * Called by LTC_Trigger() when the timer has elapsed, before the wait for the SPI transfers.
+ *
+ * @return  void
+ */
+extern void LTC_TIMING_TimerElapsed(void);
+
+/**
+ * @brief   marks the end of the wait for the SPI transfers.
+ *
+ * Called by LTC_Trigger() before the state machine is executed.
+ *
+ * @return  void
+ */
+extern void LTC_TIMING_StepStart(void);
+
+/**
+ * @brief   marks the end of the execution of the state machine.
+ *
+ * If the state or substate changed, the visit of the previous substate is stored in the trace
+ * buffer and the time spent in the previous state is evaluated.
+ *
+ * @param   state       state after the execution (LTC_STATEMACH_e)
+ * @param   substate    substate after the execution
+ *
+ * @return  void
+ */
+extern void LTC_TIMING_StepEnd(uint8_t state, uint8_t substate);
+
+/**
+ * @brief   marks the end of a measurement cycle.
+ *
+ * @return  void
+ */
+extern void LTC_TIMING_CycleFinished(void);
+
+/**
+ * @brief   gets an entry of the trace buffer.
+ *
+ * The trace buffer is written by the LTC task, it should be read from the same task or while
+ * the LTC driver is stopped.
+ *
+ * @param   index       index of the entry, 0 is the oldest entry in the ring buffer
+ * @param   *entry      entry (output)
+ *
+ * @return  E_OK if the entry was copied, E_NOT_OK if the index is invalid
+ */
+extern STD_RETURN_TYPE_e LTC_TIMING_GetTraceEntry(uint16_t index, LTC_TIMING_TRACE_ENTRY_s *entry);
+
+/**
+ * @brief   stores the statistics in DATA_BLOCK_ID_LTC_TIMING every LTC_TIMING_PERIOD_MS.
+ *
+ * Must be called periodically (1ms). The statistics are printed every LTC_TIMING_PRINT_PERIOD_MS,
+ * one line every LTC_TIMING_PRINT_LINE_MS.
+ *
+ * @return  void
+ */
+extern void LTC_TIMING_Trigger(void);
+
+/**
+ * @brief   starts the output of the statistics and the last LTC_TIMING_PRINT_TRACE_ENTRIES visits of the trace buffer.
+ *
+ * The trace entries are copied at the call, the lines are printed by LTC_TIMING_Trigger() one every
+ * LTC_TIMING_PRINT_LINE_MS, so that the transmit buffer of the UART does not overflow. Uses
+ * DEBUG_PRINTF, i.e. nothing is printed without BUILD_MODULE_DEBUGPRINTF. Must be called from the
+ * task of the LTC driver (see LTC_TIMING_GetTraceEntry()).
+ *
+ * @return  void
+ */
+extern void LTC_TIMING_Print(void);
+
+/*================== Function Implementations =============================*/
+
+#endif /* LTC_TIMING_H_ */
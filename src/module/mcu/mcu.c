@@ -155,6 +155,32 @@ uint32_t MCU_GetTimeStamp(void) {
      return osKernelSysTick();
 }
 
+uint32_t MCU_GetTime_us(void) {
+
+    uint32_t ticks_ms = 0;
+    uint32_t counter = 0;
+    uint32_t counter_check = 0;
+    uint32_t reload = 0;
+    uint32_t pending = 0;
+
+    do {
+        counter = SysTick->VAL;
+        ticks_ms = osKernelSysTick();
+        pending = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+        counter_check = SysTick->VAL;
+    } while (counter_check > counter);     // SysTick reloaded between both reads
+
+    if (pending != 0) {
+        // SysTick reloaded, but its interrupt is not executed yet (interrupts masked or called
+        // from an interrupt of higher priority): the OS tick is not incremented yet
+        ticks_ms++;
+    }
+
+    reload = SysTick->LOAD + 1;
+
+    return (ticks_ms*1000 + ((reload - 1 - counter)*1000)/reload);
+}
+
 
 void MCU_GetDeviceID(MCU_DeviceID_s * deviceID) {
 
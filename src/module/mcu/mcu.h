@@ -100,6 +100,19 @@ extern uint32_t MCU_GetTimeBase(void);
  */
 extern uint32_t MCU_GetTimeStamp(void);
 
+/**
+ * @brief   returns the system time with a resolution of 1us.
+ *
+ * Combines the OS tick with the SysTick down-counter. A reload of the SysTick whose interrupt
+ * is still pending is taken into account, so the time does not go backwards when called with
+ * masked interrupts or from an interrupt.
+ * The time overflows after 2^32 us (~71.6 minutes). Time differences must therefore be computed
+ * with unsigned (or casted signed) 32 bit subtraction and are only valid below this period.
+ *
+ * @return  time in us
+ */
+extern uint32_t MCU_GetTime_us(void);
+
 /**
  * @brief   Get unique device ID
  *
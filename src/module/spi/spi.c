@@ -52,7 +52,19 @@
 /*================== Constant and Variable Definitions ====================*/
 const uint8_t spi_cmdDummy[1]={0x00};
 
+/**
+ * Frame queue for asynchronous DMA transfers. The task queuing frames only
+ * writes the tail, the transfer complete interrupt only writes the head,
+ * so no critical section is needed (the DMA interrupts run above
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY and would not be masked anyway).
+ * Both indices are free running 8 bit counters, the queue slot is index % SPI_QUEUE_LENGTH.
+ */
+static SPI_QUEUE_s spi_queue;
+
 /*================== Function Prototypes ==================================*/
+static STD_RETURN_TYPE_e SPI_Enqueue(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint8_t *frameID);
+static void SPI_StartQueuedFrame(void);
+static uint8_t SPI_FinishQueuedFrame(SPI_HandleTypeDef *hspi, SPI_FRAME_STATE_e state);
 
 
 /*================== Function Implementations =============================*/
@@ -110,6 +122,9 @@ void SPI_Init(SPI_HandleTypeDef *hspi) {
 
 
 void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) {
+    if (SPI_FinishQueuedFrame(hspi, SPI_FRAME_DONE) == TRUE) {
+        return;
+    }
     if (hspi  ==  &spi_devices[0])        // Iso-SPI Main
     {
         SPI_UnsetCS(1);
@@ -125,6 +140,9 @@ void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) {
 
 void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
 {
+    if (SPI_FinishQueuedFrame(hspi, SPI_FRAME_DONE) == TRUE) {
+        return;
+    }
     if (hspi  ==  &spi_devices[0])        // Iso-SPI Main
     {
         SPI_UnsetCS(1);
@@ -137,6 +155,11 @@ void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
 }
 
 
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+    SPI_FinishQueuedFrame(hspi, SPI_FRAME_ERROR);
+}
+
+
 void SPI_SetCS(uint8_t busID) {
 
     switch(busID) {
@@ -259,3 +282,176 @@ STD_RETURN_TYPE_e SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData,
 
 }
 
+
+STD_RETURN_TYPE_e SPI_QueueTransmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint8_t *frameID) {
+    return SPI_Enqueue(hspi, pData, NULL_PTR, Size, frameID);
+}
+
+
+STD_RETURN_TYPE_e SPI_QueueTransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint8_t *frameID) {
+    return SPI_Enqueue(hspi, pTxData, pRxData, Size, frameID);
+}
+
+
+SPI_FRAME_STATE_e SPI_GetFrameState(uint8_t frameID) {
+
+    SPI_FRAME_s *frame = &spi_queue.frame[frameID % SPI_QUEUE_LENGTH];
+    SPI_FRAME_STATE_e state = SPI_FRAME_DONE;
+
+    if (frame->frameID == frameID) {
+        state = frame->state;
+    }
+    return state;
+}
+
+
+uint8_t SPI_IsQueueIdle(void) {
+
+    uint8_t retVal = FALSE;
+
+    if (spi_queue.head == spi_queue.tail) {
+        retVal = TRUE;
+    }
+    return retVal;
+}
+
+
+uint32_t SPI_GetIdleTime_us(void) {
+
+    uint32_t retVal = 0;
+
+    // while the queue is idle, the interrupt does not write lastFrameEnd_us
+    if (spi_queue.busy == FALSE) {
+        retVal = MCU_GetTime_us() - spi_queue.lastFrameEnd_us;
+    }
+    return retVal;
+}
+
+
+STD_RETURN_TYPE_e SPI_SetPrescaler(SPI_HandleTypeDef *hspi, uint32_t prescaler) {
+
+    if ((SPI_IsQueueIdle() == FALSE) || (hspi->State != HAL_SPI_STATE_READY)) {
+        return E_NOT_OK;
+    }
+
+    // the baud rate must not be changed while the SPI is enabled
+    __HAL_SPI_DISABLE(hspi);
+    MODIFY_REG(hspi->Instance->CR1, SPI_CR1_BR, prescaler);
+    hspi->Init.BaudRatePrescaler = prescaler;
+
+    return E_OK;
+}
+
+
+/**
+ * @brief   appends a frame to the transfer queue and starts it if the queue is idle.
+ *
+ * @param   *hspi         pointer to SPI hardware handle
+ * @param   *pTxData      data to be sent
+ * @param   *pRxData      data to be received, NULL_PTR for transmit-only frames
+ * @param   Size          size of the data to be sent/received
+ * @param   *frameID      returns the ID of the queued frame (can be NULL_PTR)
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK if the queue is full
+ */
+static STD_RETURN_TYPE_e SPI_Enqueue(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint8_t *frameID) {
+
+    uint8_t tail = spi_queue.tail;
+    SPI_FRAME_s *frame = NULL_PTR;
+
+    if ((uint8_t)(tail - spi_queue.head) >= SPI_QUEUE_LENGTH) {
+        return E_NOT_OK;
+    }
+
+    frame = &spi_queue.frame[tail % SPI_QUEUE_LENGTH];
+    frame->hspi = hspi;
+    frame->pTxData = pTxData;
+    frame->pRxData = pRxData;
+    frame->Size = Size;
+    frame->busID = 1;       // same chip select as SPI_Transmit()/SPI_TransmitReceive()
+    frame->frameID = tail;
+    frame->state = SPI_FRAME_QUEUED;
+    if (frameID != NULL_PTR) {
+        *frameID = tail;
+    }
+
+    // publish the frame, from now on the transfer complete interrupt may start it
+    spi_queue.tail = (uint8_t)(tail + 1);
+
+    if (spi_queue.busy == FALSE) {
+        // no transfer running, so no interrupt can start the frame
+        spi_queue.busy = TRUE;
+        SPI_StartQueuedFrame();
+    }
+
+    return E_OK;
+}
+
+
+/**
+ * @brief   starts the DMA transfer of the oldest queued frame.
+ *
+ * Frames that cannot be started are marked as erroneous and the next frame is
+ * tried. Clears the busy flag of the queue once it is empty.
+ * Called from the task queuing the frames (queue idle) or from the transfer
+ * complete interrupt (queue busy), never from both at the same time.
+ *
+ * @return  none(void)
+ */
+static void SPI_StartQueuedFrame(void) {
+
+    HAL_StatusTypeDef statusSPI = HAL_ERROR;
+    SPI_FRAME_s *frame = NULL_PTR;
+
+    while (spi_queue.head != spi_queue.tail) {
+        frame = &spi_queue.frame[spi_queue.head % SPI_QUEUE_LENGTH];
+        frame->state = SPI_FRAME_ACTIVE;
+
+        SPI_SetCS(frame->busID);
+        if (frame->pRxData == NULL_PTR) {
+            statusSPI = HAL_SPI_Transmit_DMA(frame->hspi, frame->pTxData, frame->Size);
+        } else {
+            statusSPI = HAL_SPI_TransmitReceive_DMA(frame->hspi, frame->pTxData, frame->pRxData, frame->Size);
+        }
+        if (statusSPI == HAL_OK) {
+            return;
+        }
+
+        SPI_UnsetCS(frame->busID);
+        frame->state = SPI_FRAME_ERROR;
+        spi_queue.head = (uint8_t)(spi_queue.head + 1);
+    }
+
+    spi_queue.busy = FALSE;
+}
+
+
+/**
+ * @brief   finishes the active queued frame and starts the next one.
+ *
+ * @param   *hspi       pointer to SPI hardware handle of the callback
+ * @param   state       final state of the frame (SPI_FRAME_DONE or SPI_FRAME_ERROR)
+ *
+ * @return  TRUE if the callback belonged to a queued frame, FALSE otherwise
+ */
+static uint8_t SPI_FinishQueuedFrame(SPI_HandleTypeDef *hspi, SPI_FRAME_STATE_e state) {
+
+    SPI_FRAME_s *frame = NULL_PTR;
+
+    if (spi_queue.busy == FALSE) {
+        return FALSE;
+    }
+
+    frame = &spi_queue.frame[spi_queue.head % SPI_QUEUE_LENGTH];
+    if (frame->hspi != hspi || frame->state != SPI_FRAME_ACTIVE) {
+        return FALSE;
+    }
+
+    SPI_UnsetCS(frame->busID);
+    frame->state = state;
+    spi_queue.lastFrameEnd_us = MCU_GetTime_us();
+    spi_queue.head = (uint8_t)(spi_queue.head + 1);
+    SPI_StartQueuedFrame();
+
+    return TRUE;
+}
@@ -40,6 +40,40 @@
 
 /*================== Macros and Definitions ===============================*/
 
+/**
+ * state of a frame queued with SPI_QueueTransmit()/SPI_QueueTransmitReceive()
+ */
+typedef enum {
+    SPI_FRAME_QUEUED    = 0,    /*!< frame waits for the previous frames to be finished */
+    SPI_FRAME_ACTIVE    = 1,    /*!< DMA transfer of the frame is running */
+    SPI_FRAME_DONE      = 2,    /*!< transfer completed */
+    SPI_FRAME_ERROR     = 3,    /*!< transfer could not be started or was aborted by the HAL */
+} SPI_FRAME_STATE_e;
+
+/**
+ * descriptor of a frame in the SPI transfer queue
+ */
+typedef struct {
+    SPI_HandleTypeDef *hspi;            /*!< SPI hardware handle used for the transfer */
+    uint8_t *pTxData;                   /*!< data to be sent */
+    uint8_t *pRxData;                   /*!< receive buffer, NULL_PTR for transmit-only frames */
+    uint16_t Size;                      /*!< number of bytes to be sent/received */
+    uint8_t busID;                      /*!< chip select used for the transfer */
+    uint8_t frameID;                    /*!< sequence number of the frame */
+    volatile SPI_FRAME_STATE_e state;   /*!< state of the frame */
+} SPI_FRAME_s;
+
+/**
+ * transfer queue of the asynchronous DMA transfers
+ */
+typedef struct {
+    SPI_FRAME_s frame[SPI_QUEUE_LENGTH];    /*!< ring of frame descriptors */
+    volatile uint8_t head;                  /*!< oldest frame not yet finished, only written by the transfer complete interrupt */
+    volatile uint8_t tail;                  /*!< next frame to be queued, only written by the task queuing the frames */
+    volatile uint8_t busy;                  /*!< TRUE while a frame of the queue is transferred */
+    volatile uint32_t lastFrameEnd_us;      /*!< end of the last finished frame (MCU_GetTime_us()), only written by the transfer complete interrupt */
+} SPI_QUEUE_s;
+
 /*================== Constant and Variable Definitions ====================*/
 
 /*================== Function Prototypes ==================================*/
@@ -73,6 +107,17 @@ extern void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi);
  */
 extern void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
 
+/**
+ * @brief  callback SPI error from SPI-Interrupt
+ *
+ * Marks a running queued frame as erroneous and starts the next queued frame.
+ *
+ * @param  hspi:     pointer to SPI hardware handle
+ *
+ * @return none(void)
+ */
+extern void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+
 /**
  * @brief   transmits through SPI without receiving data.
  *
@@ -96,6 +141,80 @@ extern STD_RETURN_TYPE_e SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, u
  */
 extern STD_RETURN_TYPE_e SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
 
+/**
+ * @brief   queues a frame to be transmitted through SPI without receiving data.
+ *
+ * The frame is started immediately if the queue is idle, otherwise it is started
+ * by the transfer complete callback of the previous frame. The data buffer must
+ * not be modified until the frame is finished (see SPI_GetFrameState()).
+ * The queue has a single producer: frames must only be queued from one task.
+ *
+ * @param   *hspi       pointer to SPI hardware handle
+ * @param   *pData      data to be sent
+ * @param   Size        size of the data to be sent
+ * @param   *frameID    returns the ID of the queued frame (can be NULL_PTR)
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK if the queue is full
+ */
+extern STD_RETURN_TYPE_e SPI_QueueTransmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint8_t *frameID);
+
+/**
+ * @brief   queues a frame to be transmitted and received through SPI.
+ *
+ * See SPI_QueueTransmit(). The receive buffer is only valid after the frame is
+ * in state SPI_FRAME_DONE.
+ *
+ * @param   *hspi         pointer to SPI hardware handle
+ * @param   *pTxData      data to be sent
+ * @param   *pRxData      data to be received
+ * @param   Size          size of the data to be sent/received
+ * @param   *frameID      returns the ID of the queued frame (can be NULL_PTR)
+ *
+ * @return  E_OK if the frame was queued, E_NOT_OK if the queue is full
+ */
+extern STD_RETURN_TYPE_e SPI_QueueTransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint8_t *frameID);
+
+/**
+ * @brief   gets the state of a queued frame.
+ *
+ * Frames whose queue slot has already been reused by a newer frame are
+ * reported as SPI_FRAME_DONE.
+ *
+ * @param   frameID     ID returned by SPI_QueueTransmit()/SPI_QueueTransmitReceive()
+ *
+ * @return  state of the frame
+ */
+extern SPI_FRAME_STATE_e SPI_GetFrameState(uint8_t frameID);
+
+/**
+ * @brief   checks if all queued frames are finished.
+ *
+ * @return  TRUE if no frame is queued or active, FALSE otherwise
+ */
+extern uint8_t SPI_IsQueueIdle(void);
+
+/**
+ * @brief   gets the time since the end of the last queued transfer.
+ *
+ * Frames that are queued but not transferred yet are not taken into account.
+ *
+ * @return  time since the end of the last queued frame in us, 0 while a frame is transferred
+ */
+extern uint32_t SPI_GetIdleTime_us(void);
+
+/**
+ * @brief   changes the baud rate prescaler of an SPI device.
+ *
+ * The prescaler is only changed if no frame is queued or transferred, the SPI device is
+ * disabled and enabled again by the HAL with the next transfer.
+ *
+ * @param   *hspi       pointer to SPI hardware handle
+ * @param   prescaler   new prescaler (SPI_BAUDRATEPRESCALER_2 to SPI_BAUDRATEPRESCALER_256)
+ *
+ * @return  E_OK if the prescaler was changed, E_NOT_OK if the SPI device is busy
+ */
+extern STD_RETURN_TYPE_e SPI_SetPrescaler(SPI_HandleTypeDef *hspi, uint32_t prescaler);
+
 /**
  * @brief sets Chip Select low to start SPI transmission.
  *